@@ -51,6 +51,161 @@
 #define FASTNOISELITE_H
 
 #include <cmath>
+#include <cstddef>
+
+// Batch noise (GetNoiseBatch) runs AVX2 kernels 8 points at a time when the compiler targets
+// AVX2, SSE2 kernels 4 at a time on any other x86-64 build, and the scalar path otherwise.
+// Define FNL_NO_SIMD to force the scalar path.
+#if !defined(FNL_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FNL_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FNL_SIMD_SSE2
+#endif
+#endif
+
+#if defined(FNL_SIMD_AVX2) || defined(FNL_SIMD_SSE2)
+#define FNL_SIMD
+
+// Thin wrappers around the native vector registers so the batch kernels in FastNoiseLite
+// read like their scalar counterparts. Comparisons return lane masks stored as Float.
+namespace FNLSimd
+{
+#if defined(FNL_SIMD_AVX2)
+    static const int Width = 8;
+
+    struct Float { __m256 v; };
+    struct Int { __m256i v; };
+
+    inline Float Set(float f) { return { _mm256_set1_ps(f) }; }
+    inline Int SetI(int i) { return { _mm256_set1_epi32(i) }; }
+    inline Float Load(const float* p) { return { _mm256_loadu_ps(p) }; }
+    inline void Store(float* p, Float f) { _mm256_storeu_ps(p, f.v); }
+
+    inline Float operator+(Float a, Float b) { return { _mm256_add_ps(a.v, b.v) }; }
+    inline Float operator-(Float a, Float b) { return { _mm256_sub_ps(a.v, b.v) }; }
+    inline Float operator*(Float a, Float b) { return { _mm256_mul_ps(a.v, b.v) }; }
+    inline Float operator/(Float a, Float b) { return { _mm256_div_ps(a.v, b.v) }; }
+    inline Float operator-(Float a) { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)) }; }
+    inline Float operator&(Float a, Float b) { return { _mm256_and_ps(a.v, b.v) }; }
+    inline Float operator|(Float a, Float b) { return { _mm256_or_ps(a.v, b.v) }; }
+    inline Float AndNot(Float mask, Float b) { return { _mm256_andnot_ps(mask.v, b.v) }; }
+
+    inline Float operator<(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+    inline Float operator>(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+    inline Float operator<=(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+    inline Float operator>=(Float a, Float b) { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+
+    inline Float Min(Float a, Float b) { return { _mm256_min_ps(a.v, b.v) }; }
+    inline Float Max(Float a, Float b) { return { _mm256_max_ps(a.v, b.v) }; }
+    inline Float Abs(Float a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+    inline Float Sqrt(Float a) { return { _mm256_sqrt_ps(a.v) }; }
+    inline Float Select(Float mask, Float a, Float b) { return { _mm256_blendv_ps(b.v, a.v, mask.v) }; }
+
+    inline Int operator+(Int a, Int b) { return { _mm256_add_epi32(a.v, b.v) }; }
+    inline Int operator-(Int a, Int b) { return { _mm256_sub_epi32(a.v, b.v) }; }
+    inline Int operator*(Int a, Int b) { return { _mm256_mullo_epi32(a.v, b.v) }; }
+    inline Int operator^(Int a, Int b) { return { _mm256_xor_si256(a.v, b.v) }; }
+    inline Int operator&(Int a, Int b) { return { _mm256_and_si256(a.v, b.v) }; }
+    inline Int operator|(Int a, Int b) { return { _mm256_or_si256(a.v, b.v) }; }
+    inline Int operator>>(Int a, int n) { return { _mm256_sra_epi32(a.v, _mm_cvtsi32_si128(n)) }; }
+    inline Int Select(Float mask, Int a, Int b)
+    {
+        return { _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(b.v), _mm256_castsi256_ps(a.v), mask.v)) };
+    }
+
+    inline Int MaskToInt(Float mask) { return { _mm256_castps_si256(mask.v) }; }
+    inline Float Convert(Int a) { return { _mm256_cvtepi32_ps(a.v) }; }
+    inline Int Truncate(Float a) { return { _mm256_cvttps_epi32(a.v) }; }
+    inline Float Gather(const float* table, Int index) { return { _mm256_i32gather_ps(table, index.v, 4) }; }
+    inline bool All(Float mask) { return _mm256_movemask_ps(mask.v) == 0xFF; }
+#else
+    static const int Width = 4;
+
+    struct Float { __m128 v; };
+    struct Int { __m128i v; };
+
+    inline Float Set(float f) { return { _mm_set1_ps(f) }; }
+    inline Int SetI(int i) { return { _mm_set1_epi32(i) }; }
+    inline Float Load(const float* p) { return { _mm_loadu_ps(p) }; }
+    inline void Store(float* p, Float f) { _mm_storeu_ps(p, f.v); }
+
+    inline Float operator+(Float a, Float b) { return { _mm_add_ps(a.v, b.v) }; }
+    inline Float operator-(Float a, Float b) { return { _mm_sub_ps(a.v, b.v) }; }
+    inline Float operator*(Float a, Float b) { return { _mm_mul_ps(a.v, b.v) }; }
+    inline Float operator/(Float a, Float b) { return { _mm_div_ps(a.v, b.v) }; }
+    inline Float operator-(Float a) { return { _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)) }; }
+    inline Float operator&(Float a, Float b) { return { _mm_and_ps(a.v, b.v) }; }
+    inline Float operator|(Float a, Float b) { return { _mm_or_ps(a.v, b.v) }; }
+    inline Float AndNot(Float mask, Float b) { return { _mm_andnot_ps(mask.v, b.v) }; }
+
+    inline Float operator<(Float a, Float b) { return { _mm_cmplt_ps(a.v, b.v) }; }
+    inline Float operator>(Float a, Float b) { return { _mm_cmpgt_ps(a.v, b.v) }; }
+    inline Float operator<=(Float a, Float b) { return { _mm_cmple_ps(a.v, b.v) }; }
+    inline Float operator>=(Float a, Float b) { return { _mm_cmpge_ps(a.v, b.v) }; }
+
+    inline Float Min(Float a, Float b) { return { _mm_min_ps(a.v, b.v) }; }
+    inline Float Max(Float a, Float b) { return { _mm_max_ps(a.v, b.v) }; }
+    inline Float Abs(Float a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+    inline Float Sqrt(Float a) { return { _mm_sqrt_ps(a.v) }; }
+    inline Float Select(Float mask, Float a, Float b) { return { _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v)) }; }
+
+    inline Int operator+(Int a, Int b) { return { _mm_add_epi32(a.v, b.v) }; }
+    inline Int operator-(Int a, Int b) { return { _mm_sub_epi32(a.v, b.v) }; }
+    inline Int operator*(Int a, Int b)
+    {
+        // SSE2 has no 32-bit mullo, multiply even and odd lanes separately and interleave
+        __m128i even = _mm_mul_epu32(a.v, b.v);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a.v, 32), _mm_srli_epi64(b.v, 32));
+        return { _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))) };
+    }
+    inline Int operator^(Int a, Int b) { return { _mm_xor_si128(a.v, b.v) }; }
+    inline Int operator&(Int a, Int b) { return { _mm_and_si128(a.v, b.v) }; }
+    inline Int operator|(Int a, Int b) { return { _mm_or_si128(a.v, b.v) }; }
+    inline Int operator>>(Int a, int n) { return { _mm_sra_epi32(a.v, _mm_cvtsi32_si128(n)) }; }
+    inline Int Select(Float mask, Int a, Int b)
+    {
+        __m128i m = _mm_castps_si128(mask.v);
+        return { _mm_or_si128(_mm_and_si128(m, a.v), _mm_andnot_si128(m, b.v)) };
+    }
+
+    inline Int MaskToInt(Float mask) { return { _mm_castps_si128(mask.v) }; }
+    inline Float Convert(Int a) { return { _mm_cvtepi32_ps(a.v) }; }
+    inline Int Truncate(Float a) { return { _mm_cvttps_epi32(a.v) }; }
+    inline Float Gather(const float* table, Int index)
+    {
+        alignas(16) int i[4];
+        _mm_store_si128((__m128i*)i, index.v);
+        return { _mm_setr_ps(table[i[0]], table[i[1]], table[i[2]], table[i[3]]) };
+    }
+    inline bool All(Float mask) { return _mm_movemask_ps(mask.v) == 0xF; }
+#endif
+
+    // Mixed scalar/vector arithmetic, so kernel constants can stay plain floats and ints
+    inline Float operator+(Float a, float b) { return a + Set(b); }
+    inline Float operator+(float a, Float b) { return Set(a) + b; }
+    inline Float operator-(Float a, float b) { return a - Set(b); }
+    inline Float operator-(float a, Float b) { return Set(a) - b; }
+    inline Float operator*(Float a, float b) { return a * Set(b); }
+    inline Float operator*(float a, Float b) { return Set(a) * b; }
+    inline Float operator<(Float a, float b) { return a < Set(b); }
+    inline Float operator>(Float a, float b) { return a > Set(b); }
+    inline Float operator>=(Float a, float b) { return a >= Set(b); }
+
+    inline Int operator+(Int a, int b) { return a + SetI(b); }
+    inline Int operator-(Int a, int b) { return a - SetI(b); }
+    inline Int operator-(Int a) { return SetI(0) - a; }
+    inline Int operator*(Int a, int b) { return a * SetI(b); }
+    inline Int operator^(Int a, int b) { return a ^ SetI(b); }
+    inline Int operator&(Int a, int b) { return a & SetI(b); }
+    inline Int operator|(Int a, int b) { return a | SetI(b); }
+}
+#endif
+
+template <typename Settings>
+class FastNoiseStatic;
 
 class FastNoiseLite
 {
@@ -339,6 +494,94 @@ public:
     }
 
 
+    /// <summary>
+    /// 2D noise at n positions using current settings, out[i] = GetNoise(xs[i], ys[i])
+    /// </summary>
+    /// <remarks>
+    /// Settings are dispatched once for the whole batch. OpenSimplex2 and Cellular, with any
+    /// fractal type, are evaluated FNLSimd::Width points at a time; other noise types fall
+    /// back to GetNoise per point. Results match GetNoise up to float rounding.
+    /// </remarks>
+    void GetNoiseBatch(const float* xs, const float* ys, float* out, size_t n) const
+    {
+#if defined(FNL_SIMD)
+        switch (mNoiseType)
+        {
+        case NoiseType_OpenSimplex2:
+            SimdFractalBatch<true>(xs, ys, out, n,
+                [](int seed, SimdFloat x, SimdFloat y) { return SimdSingleSimplex(seed, x, y); });
+            return;
+        case NoiseType_Cellular:
+            switch (mCellularDistanceFunction)
+            {
+            default:
+            case CellularDistanceFunction_Euclidean:
+            case CellularDistanceFunction_EuclideanSq:
+                SimdFractalBatch<false>(xs, ys, out, n,
+                    [this](int seed, SimdFloat x, SimdFloat y) { return SimdSingleCellular<CellularDistanceFunction_EuclideanSq>(seed, x, y); });
+                return;
+            case CellularDistanceFunction_Manhattan:
+                SimdFractalBatch<false>(xs, ys, out, n,
+                    [this](int seed, SimdFloat x, SimdFloat y) { return SimdSingleCellular<CellularDistanceFunction_Manhattan>(seed, x, y); });
+                return;
+            case CellularDistanceFunction_Hybrid:
+                SimdFractalBatch<false>(xs, ys, out, n,
+                    [this](int seed, SimdFloat x, SimdFloat y) { return SimdSingleCellular<CellularDistanceFunction_Hybrid>(seed, x, y); });
+                return;
+            }
+        default:
+            break;
+        }
+#endif
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = GetNoise(xs[i], ys[i]);
+        }
+    }
+
+    /// <summary>
+    /// 3D noise at n positions using current settings, out[i] = GetNoise(xs[i], ys[i], zs[i])
+    /// </summary>
+    /// <remarks>
+    /// Same dispatch and fallback rules as the 2D GetNoiseBatch
+    /// </remarks>
+    void GetNoiseBatch(const float* xs, const float* ys, const float* zs, float* out, size_t n) const
+    {
+#if defined(FNL_SIMD)
+        switch (mNoiseType)
+        {
+        case NoiseType_OpenSimplex2:
+            SimdFractalBatch(xs, ys, zs, out, n,
+                [](int seed, SimdFloat x, SimdFloat y, SimdFloat z) { return SimdSingleOpenSimplex2(seed, x, y, z); });
+            return;
+        case NoiseType_Cellular:
+            switch (mCellularDistanceFunction)
+            {
+            default:
+            case CellularDistanceFunction_Euclidean:
+            case CellularDistanceFunction_EuclideanSq:
+                SimdFractalBatch(xs, ys, zs, out, n,
+                    [this](int seed, SimdFloat x, SimdFloat y, SimdFloat z) { return SimdSingleCellular<CellularDistanceFunction_EuclideanSq>(seed, x, y, z); });
+                return;
+            case CellularDistanceFunction_Manhattan:
+                SimdFractalBatch(xs, ys, zs, out, n,
+                    [this](int seed, SimdFloat x, SimdFloat y, SimdFloat z) { return SimdSingleCellular<CellularDistanceFunction_Manhattan>(seed, x, y, z); });
+                return;
+            case CellularDistanceFunction_Hybrid:
+                SimdFractalBatch(xs, ys, zs, out, n,
+                    [this](int seed, SimdFloat x, SimdFloat y, SimdFloat z) { return SimdSingleCellular<CellularDistanceFunction_Hybrid>(seed, x, y, z); });
+                return;
+            }
+        default:
+            break;
+        }
+#endif
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = GetNoise(xs[i], ys[i], zs[i]);
+        }
+    }
+
     /// <summary>
     /// 2D warps the input position using current domain warp settings
     /// </summary>
@@ -394,6 +637,9 @@ public:
     }
 
 private:
+    template <typename Settings>
+    friend class FastNoiseStatic;
+
     template <typename T>
     struct Arguments_must_be_floating_point_values;
 
@@ -2442,145 +2688,1638 @@ private:
         yr += vy * warpAmp;
         zr += vz * warpAmp;
     }
-};
 
-template <>
-struct FastNoiseLite::Arguments_must_be_floating_point_values<float> {};
-template <>
-struct FastNoiseLite::Arguments_must_be_floating_point_values<double> {};
-template <>
-struct FastNoiseLite::Arguments_must_be_floating_point_values<long double> {};
 
-template <typename T>
-const T FastNoiseLite::Lookup<T>::Gradients2D[] =
-{
-    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
-    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
-    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
-    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
-    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
-    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
-    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
-    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
-    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
-    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
-    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
-    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
-    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
-    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
-    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
-    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
-    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
-    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
-    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
-    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
-    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
-    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
-    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
-    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
-    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
-    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
-    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
-    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
-    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
-    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
-    0.38268343236509f, 0.923879532511287f, 0.923879532511287f, 0.38268343236509f, 0.923879532511287f, -0.38268343236509f, 0.38268343236509f, -0.923879532511287f,
-    -0.38268343236509f, -0.923879532511287f, -0.923879532511287f, -0.38268343236509f, -0.923879532511287f, 0.38268343236509f, -0.38268343236509f, 0.923879532511287f,
-};
+    // SIMD batch noise
+    // Each kernel mirrors its scalar counterpart above, with branches turned into lane masks
 
-template <typename T>
-const T FastNoiseLite::Lookup<T>::RandVecs2D[] =
-{
-    -0.2700222198f, -0.9628540911f, 0.3863092627f, -0.9223693152f, 0.04444859006f, -0.999011673f, -0.5992523158f, -0.8005602176f, -0.7819280288f, 0.6233687174f, 0.9464672271f, 0.3227999196f, -0.6514146797f, -0.7587218957f, 0.9378472289f, 0.347048376f,
-    -0.8497875957f, -0.5271252623f, -0.879042592f, 0.4767432447f, -0.892300288f, -0.4514423508f, -0.379844434f, -0.9250503802f, -0.9951650832f, 0.0982163789f, 0.7724397808f, -0.6350880136f, 0.7573283322f, -0.6530343002f, -0.9928004525f, -0.119780055f,
-    -0.0532665713f, 0.9985803285f, 0.9754253726f, -0.2203300762f, -0.7665018163f, 0.6422421394f, 0.991636706f, 0.1290606184f, -0.994696838f, 0.1028503788f, -0.5379205513f, -0.84299554f, 0.5022815471f, -0.8647041387f, 0.4559821461f, -0.8899889226f,
-    -0.8659131224f, -0.5001944266f, 0.0879458407f, -0.9961252577f, -0.5051684983f, 0.8630207346f, 0.7753185226f, -0.6315704146f, -0.6921944612f, 0.7217110418f, -0.5191659449f, -0.8546734591f, 0.8978622882f, -0.4402764035f, -0.1706774107f, 0.9853269617f,
-    -0.9353430106f, -0.3537420705f, -0.9992404798f, 0.03896746794f, -0.2882064021f, -0.9575683108f, -0.9663811329f, 0.2571137995f, -0.8759714238f, -0.4823630009f, -0.8303123018f, -0.5572983775f, 0.05110133755f, -0.9986934731f, -0.8558373281f, -0.5172450752f,
-    0.09887025282f, 0.9951003332f, 0.9189016087f, 0.3944867976f, -0.2439375892f, -0.9697909324f, -0.8121409387f, -0.5834613061f, -0.9910431363f, 0.1335421355f, 0.8492423985f, -0.5280031709f, -0.9717838994f, -0.2358729591f, 0.9949457207f, 0.1004142068f,
-    0.6241065508f, -0.7813392434f, 0.662910307f, 0.7486988212f, -0.7197418176f, 0.6942418282f, -0.8143370775f, -0.5803922158f, 0.104521054f, -0.9945226741f, -0.1065926113f, -0.9943027784f, 0.445799684f, -0.8951327509f, 0.105547406f, 0.9944142724f,
-    -0.992790267f, 0.1198644477f, -0.8334366408f, 0.552615025f, 0.9115561563f, -0.4111755999f, 0.8285544909f, -0.5599084351f, 0.7217097654f, -0.6921957921f, 0.4940492677f, -0.8694339084f, -0.3652321272f, -0.9309164803f, -0.9696606758f, 0.2444548501f,
-    0.08925509731f, -0.996008799f, 0.5354071276f, -0.8445941083f, -0.1053576186f, 0.9944343981f, -0.9890284586f, 0.1477251101f, 0.004856104961f, 0.9999882091f, 0.9885598478f, 0.1508291331f, 0.9286129562f, -0.3710498316f, -0.5832393863f, -0.8123003252f,
-    0.3015207509f, 0.9534596146f, -0.9575110528f, 0.2883965738f, 0.9715802154f, -0.2367105511f, 0.229981792f, 0.9731949318f, 0.955763816f, -0.2941352207f, 0.740956116f, 0.6715534485f, -0.9971513787f, -0.07542630764f, 0.6905710663f, -0.7232645452f,
-    -0.290713703f, -0.9568100872f, 0.5912777791f, -0.8064679708f, -0.9454592212f, -0.325740481f, 0.6664455681f, 0.74555369f, 0.6236134912f, 0.7817328275f, 0.9126993851f, -0.4086316587f, -0.8191762011f, 0.5735419353f, -0.8812745759f, -0.4726046147f,
-    0.9953313627f, 0.09651672651f, 0.9855650846f, -0.1692969699f, -0.8495980887f, 0.5274306472f, 0.6174853946f, -0.7865823463f, 0.8508156371f, 0.52546432f, 0.9985032451f, -0.05469249926f, 0.1971371563f, -0.9803759185f, 0.6607855748f, -0.7505747292f,
-    -0.03097494063f, 0.9995201614f, -0.6731660801f, 0.739491331f, -0.7195018362f, -0.6944905383f, 0.9727511689f, 0.2318515979f, 0.9997059088f, -0.0242506907f, 0.4421787429f, -0.8969269532f, 0.9981350961f, -0.061043673f, -0.9173660799f, -0.3980445648f,
-    -0.8150056635f, -0.5794529907f, -0.8789331304f, 0.4769450202f, 0.0158605829f, 0.999874213f, -0.8095464474f, 0.5870558317f, -0.9165898907f, -0.3998286786f, -0.8023542565f, 0.5968480938f, -0.5176737917f, 0.8555780767f, -0.8154407307f, -0.5788405779f,
-    0.4022010347f, -0.9155513791f, -0.9052556868f, -0.4248672045f, 0.7317445619f, 0.6815789728f, -0.5647632201f, -0.8252529947f, -0.8403276335f, -0.5420788397f, -0.9314281527f, 0.363925262f, 0.5238198472f, 0.8518290719f, 0.7432803869f, -0.6689800195f,
-    -0.985371561f, -0.1704197369f, 0.4601468731f, 0.88784281f, 0.825855404f, 0.5638819483f, 0.6182366099f, 0.7859920446f, 0.8331502863f, -0.553046653f, 0.1500307506f, 0.9886813308f, -0.662330369f, -0.7492119075f, -0.668598664f, 0.743623444f,
-    0.7025606278f, 0.7116238924f, -0.5419389763f, -0.8404178401f, -0.3388616456f, 0.9408362159f, 0.8331530315f, 0.5530425174f, -0.2989720662f, -0.9542618632f, 0.2638522993f, 0.9645630949f, 0.124108739f, -0.9922686234f, -0.7282649308f, -0.6852956957f,
-    0.6962500149f, 0.7177993569f, -0.9183535368f, 0.3957610156f, -0.6326102274f, -0.7744703352f, -0.9331891859f, -0.359385508f, -0.1153779357f, -0.9933216659f, 0.9514974788f, -0.3076565421f, -0.08987977445f, -0.9959526224f, 0.6678496916f, 0.7442961705f,
-    0.7952400393f, -0.6062947138f, -0.6462007402f, -0.7631674805f, -0.2733598753f, 0.9619118351f, 0.9669590226f, -0.254931851f, -0.9792894595f, 0.2024651934f, -0.5369502995f, -0.8436138784f, -0.270036471f, -0.9628500944f, -0.6400277131f, 0.7683518247f,
-    -0.7854537493f, -0.6189203566f, 0.06005905383f, -0.9981948257f, -0.02455770378f, 0.9996984141f, -0.65983623f, 0.751409442f, -0.6253894466f, -0.7803127835f, -0.6210408851f, -0.7837781695f, 0.8348888491f, 0.5504185768f, -0.1592275245f, 0.9872419133f,
-    0.8367622488f, 0.5475663786f, -0.8675753916f, -0.4973056806f, -0.2022662628f, -0.9793305667f, 0.9399189937f, 0.3413975472f, 0.9877404807f, -0.1561049093f, -0.9034455656f, 0.4287028224f, 0.1269804218f, -0.9919052235f, -0.3819600854f, 0.924178821f,
-    0.9754625894f, 0.2201652486f, -0.3204015856f, -0.9472818081f, -0.9874760884f, 0.1577687387f, 0.02535348474f, -0.9996785487f, 0.4835130794f, -0.8753371362f, -0.2850799925f, -0.9585037287f, -0.06805516006f, -0.99768156f, -0.7885244045f, -0.6150034663f,
-    0.3185392127f, -0.9479096845f, 0.8880043089f, 0.4598351306f, 0.6476921488f, -0.7619021462f, 0.9820241299f, 0.1887554194f, 0.9357275128f, -0.3527237187f, -0.8894895414f, 0.4569555293f, 0.7922791302f, 0.6101588153f, 0.7483818261f, 0.6632681526f,
-    -0.7288929755f, -0.6846276581f, 0.8729032783f, -0.4878932944f, 0.8288345784f, 0.5594937369f, 0.08074567077f, 0.9967347374f, 0.9799148216f, -0.1994165048f, -0.580730673f, -0.8140957471f, -0.4700049791f, -0.8826637636f, 0.2409492979f, 0.9705377045f,
-    0.9437816757f, -0.3305694308f, -0.8927998638f, -0.4504535528f, -0.8069622304f, 0.5906030467f, 0.06258973166f, 0.9980393407f, -0.9312597469f, 0.3643559849f, 0.5777449785f, 0.8162173362f, -0.3360095855f, -0.941858566f, 0.697932075f, -0.7161639607f,
-    -0.002008157227f, -0.9999979837f, -0.1827294312f, -0.9831632392f, -0.6523911722f, 0.7578824173f, -0.4302626911f, -0.9027037258f, -0.9985126289f, -0.05452091251f, -0.01028102172f, -0.9999471489f, -0.4946071129f, 0.8691166802f, -0.2999350194f, 0.9539596344f,
-    0.8165471961f, 0.5772786819f, 0.2697460475f, 0.962931498f, -0.7306287391f, -0.6827749597f, -0.7590952064f, -0.6509796216f, -0.907053853f, 0.4210146171f, -0.5104861064f, -0.8598860013f, 0.8613350597f, 0.5080373165f, 0.5007881595f, -0.8655698812f,
-    -0.654158152f, 0.7563577938f, -0.8382755311f, -0.545246856f, 0.6940070834f, 0.7199681717f, 0.06950936031f, 0.9975812994f, 0.1702942185f, -0.9853932612f, 0.2695973274f, 0.9629731466f, 0.5519612192f, -0.8338697815f, 0.225657487f, -0.9742067022f,
-    0.4215262855f, -0.9068161835f, 0.4881873305f, -0.8727388672f, -0.3683854996f, -0.9296731273f, -0.9825390578f, 0.1860564427f, 0.81256471f, 0.5828709909f, 0.3196460933f, -0.9475370046f, 0.9570913859f, 0.2897862643f, -0.6876655497f, -0.7260276109f,
-    -0.9988770922f, -0.047376731f, -0.1250179027f, 0.992154486f, -0.8280133617f, 0.560708367f, 0.9324863769f, -0.3612051451f, 0.6394653183f, 0.7688199442f, -0.01623847064f, -0.9998681473f, -0.9955014666f, -0.09474613458f, -0.81453315f, 0.580117012f,
-    0.4037327978f, -0.9148769469f, 0.9944263371f, 0.1054336766f, -0.1624711654f, 0.9867132919f, -0.9949487814f, -0.100383875f, -0.6995302564f, 0.7146029809f, 0.5263414922f, -0.85027327f, -0.5395221479f, 0.841971408f, 0.6579370318f, 0.7530729462f,
-    0.01426758847f, -0.9998982128f, -0.6734383991f, 0.7392433447f, 0.639412098f, -0.7688642071f, 0.9211571421f, 0.3891908523f, -0.146637214f, -0.9891903394f, -0.782318098f, 0.6228791163f, -0.5039610839f, -0.8637263605f, -0.7743120191f, -0.6328039957f,
-};
+#if defined(FNL_SIMD)
+    typedef FNLSimd::Float SimdFloat;
+    typedef FNLSimd::Int SimdInt;
 
-template <typename T>
-const T FastNoiseLite::Lookup<T>::Gradients3D[] =
-{
-    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
-    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
-    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
-    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
-    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
-    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
-    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
-    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
-    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
-    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
-    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
-    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
-    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
-    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
-    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
-    1, 1, 0, 0,  0,-1, 1, 0, -1, 1, 0, 0,  0,-1,-1, 0
-};
+    static SimdInt SimdFastFloor(SimdFloat f) { return FNLSimd::Truncate(f) + FNLSimd::MaskToInt(f < 0.0f); }
 
-template <typename T>
-const T FastNoiseLite::Lookup<T>::RandVecs3D[] =
-{
-    -0.7292736885f, -0.6618439697f, 0.1735581948f, 0, 0.790292081f, -0.5480887466f, -0.2739291014f, 0, 0.7217578935f, 0.6226212466f, -0.3023380997f, 0, 0.565683137f, -0.8208298145f, -0.0790000257f, 0, 0.760049034f, -0.5555979497f, -0.3370999617f, 0, 0.3713945616f, 0.5011264475f, 0.7816254623f, 0, -0.1277062463f, -0.4254438999f, -0.8959289049f, 0, -0.2881560924f, -0.5815838982f, 0.7607405838f, 0,
-    0.5849561111f, -0.662820239f, -0.4674352136f, 0, 0.3307171178f, 0.0391653737f, 0.94291689f, 0, 0.8712121778f, -0.4113374369f, -0.2679381538f, 0, 0.580981015f, 0.7021915846f, 0.4115677815f, 0, 0.503756873f, 0.6330056931f, -0.5878203852f, 0, 0.4493712205f, 0.601390195f, 0.6606022552f, 0, -0.6878403724f, 0.09018890807f, -0.7202371714f, 0, -0.5958956522f, -0.6469350577f, 0.475797649f, 0,
-    -0.5127052122f, 0.1946921978f, -0.8361987284f, 0, -0.9911507142f, -0.05410276466f, -0.1212153153f, 0, -0.2149721042f, 0.9720882117f, -0.09397607749f, 0, -0.7518650936f, -0.5428057603f, 0.3742469607f, 0, 0.5237068895f, 0.8516377189f, -0.02107817834f, 0, 0.6333504779f, 0.1926167129f, -0.7495104896f, 0, -0.06788241606f, 0.3998305789f, 0.9140719259f, 0, -0.5538628599f, -0.4729896695f, -0.6852128902f, 0,
-    -0.7261455366f, -0.5911990757f, 0.3509933228f, 0, -0.9229274737f, -0.1782808786f, 0.3412049336f, 0, -0.6968815002f, 0.6511274338f, 0.3006480328f, 0, 0.9608044783f, -0.2098363234f, -0.1811724921f, 0, 0.06817146062f, -0.9743405129f, 0.2145069156f, 0, -0.3577285196f, -0.6697087264f, -0.6507845481f, 0, -0.1868621131f, 0.7648617052f, -0.6164974636f, 0, -0.6541697588f, 0.3967914832f, 0.6439087246f, 0,
-    0.6993340405f, -0.6164538506f, 0.3618239211f, 0, -0.1546665739f, 0.6291283928f, 0.7617583057f, 0, -0.6841612949f, -0.2580482182f, -0.6821542638f, 0, 0.5383980957f, 0.4258654885f, 0.7271630328f, 0, -0.5026987823f, -0.7939832935f, -0.3418836993f, 0, 0.3202971715f, 0.2834415347f, 0.9039195862f, 0, 0.8683227101f, -0.0003762656404f, -0.4959995258f, 0, 0.791120031f, -0.08511045745f, 0.6057105799f, 0,
-    -0.04011016052f, -0.4397248749f, 0.8972364289f, 0, 0.9145119872f, 0.3579346169f, -0.1885487608f, 0, -0.9612039066f, -0.2756484276f, 0.01024666929f, 0, 0.6510361721f, -0.2877799159f, -0.7023778346f, 0, -0.2041786351f, 0.7365237271f, 0.644859585f, 0, -0.7718263711f, 0.3790626912f, 0.5104855816f, 0, -0.3060082741f, -0.7692987727f, 0.5608371729f, 0, 0.454007341f, -0.5024843065f, 0.7357899537f, 0,
-    0.4816795475f, 0.6021208291f, -0.6367380315f, 0, 0.6961980369f, -0.3222197429f, 0.641469197f, 0, -0.6532160499f, -0.6781148932f, 0.3368515753f, 0, 0.5089301236f, -0.6154662304f, -0.6018234363f, 0, -0.1635919754f, -0.9133604627f, -0.372840892f, 0, 0.52408019f, -0.8437664109f, 0.1157505864f, 0, 0.5902587356f, 0.4983817807f, -0.6349883666f, 0, 0.5863227872f, 0.494764745f, 0.6414307729f, 0,
-    0.6779335087f, 0.2341345225f, 0.6968408593f, 0, 0.7177054546f, -0.6858979348f, 0.120178631f, 0, -0.5328819713f, -0.5205125012f, 0.6671608058f, 0, -0.8654874251f, -0.0700727088f, -0.4960053754f, 0, -0.2861810166f, 0.7952089234f, 0.5345495242f, 0, -0.04849529634f, 0.9810836427f, -0.1874115585f, 0, -0.6358521667f, 0.6058348682f, 0.4781800233f, 0, 0.6254794696f, -0.2861619734f, 0.7258696564f, 0,
-    -0.2585259868f, 0.5061949264f, -0.8227581726f, 0, 0.02136306781f, 0.5064016808f, -0.8620330371f, 0, 0.200111773f, 0.8599263484f, 0.4695550591f, 0, 0.4743561372f, 0.6014985084f, -0.6427953014f, 0, 0.6622993731f, -0.5202474575f, -0.5391679918f, 0, 0.08084972818f, -0.6532720452f, 0.7527940996f, 0, -0.6893687501f, 0.0592860349f, 0.7219805347f, 0, -0.1121887082f, -0.9673185067f, 0.2273952515f, 0,
-    0.7344116094f, 0.5979668656f, -0.3210532909f, 0, 0.5789393465f, -0.2488849713f, 0.7764570201f, 0, 0.6988182827f, 0.3557169806f, -0.6205791146f, 0, -0.8636845529f, -0.2748771249f, -0.4224826141f, 0, -0.4247027957f, -0.4640880967f, 0.777335046f, 0, 0.5257722489f, -0.8427017621f, 0.1158329937f, 0, 0.9343830603f, 0.316302472f, -0.1639543925f, 0, -0.1016836419f, -0.8057303073f, -0.5834887393f, 0,
-    -0.6529238969f, 0.50602126f, -0.5635892736f, 0, -0.2465286165f, -0.9668205684f, -0.06694497494f, 0, -0.9776897119f, -0.2099250524f, -0.007368825344f, 0, 0.7736893337f, 0.5734244712f, 0.2694238123f, 0, -0.6095087895f, 0.4995678998f, 0.6155736747f, 0, 0.5794535482f, 0.7434546771f, 0.3339292269f, 0, -0.8226211154f, 0.08142581855f, 0.5627293636f, 0, -0.510385483f, 0.4703667658f, 0.7199039967f, 0,
-    -0.5764971849f, -0.07231656274f, -0.8138926898f, 0, 0.7250628871f, 0.3949971505f, -0.5641463116f, 0, -0.1525424005f, 0.4860840828f, -0.8604958341f, 0, -0.5550976208f, -0.4957820792f, 0.667882296f, 0, -0.1883614327f, 0.9145869398f, 0.357841725f, 0, 0.7625556724f, -0.5414408243f, -0.3540489801f, 0, -0.5870231946f, -0.3226498013f, -0.7424963803f, 0, 0.3051124198f, 0.2262544068f, -0.9250488391f, 0,
-    0.6379576059f, 0.577242424f, -0.5097070502f, 0, -0.5966775796f, 0.1454852398f, -0.7891830656f, 0, -0.658330573f, 0.6555487542f, -0.3699414651f, 0, 0.7434892426f, 0.2351084581f, 0.6260573129f, 0, 0.5562114096f, 0.8264360377f, -0.0873632843f, 0, -0.3028940016f, -0.8251527185f, 0.4768419182f, 0, 0.1129343818f, -0.985888439f, -0.1235710781f, 0, 0.5937652891f, -0.5896813806f, 0.5474656618f, 0,
-    0.6757964092f, -0.5835758614f, -0.4502648413f, 0, 0.7242302609f, -0.1152719764f, 0.6798550586f, 0, -0.9511914166f, 0.0753623979f, -0.2992580792f, 0, 0.2539470961f, -0.1886339355f, 0.9486454084f, 0, 0.571433621f, -0.1679450851f, -0.8032795685f, 0, -0.06778234979f, 0.3978269256f, 0.9149531629f, 0, 0.6074972649f, 0.733060024f, -0.3058922593f, 0, -0.5435478392f, 0.1675822484f, 0.8224791405f, 0,
-    -0.5876678086f, -0.3380045064f, -0.7351186982f, 0, -0.7967562402f, 0.04097822706f, -0.6029098428f, 0, -0.1996350917f, 0.8706294745f, 0.4496111079f, 0, -0.02787660336f, -0.9106232682f, -0.4122962022f, 0, -0.7797625996f, -0.6257634692f, 0.01975775581f, 0, -0.5211232846f, 0.7401644346f, -0.4249554471f, 0, 0.8575424857f, 0.4053272873f, -0.3167501783f, 0, 0.1045223322f, 0.8390195772f, -0.5339674439f, 0,
-    0.3501822831f, 0.9242524096f, -0.1520850155f, 0, 0.1987849858f, 0.07647613266f, 0.9770547224f, 0, 0.7845996363f, 0.6066256811f, -0.1280964233f, 0, 0.09006737436f, -0.9750989929f, -0.2026569073f, 0, -0.8274343547f, -0.542299559f, 0.1458203587f, 0, -0.3485797732f, -0.415802277f, 0.840000362f, 0, -0.2471778936f, -0.7304819962f, -0.6366310879f, 0, -0.3700154943f, 0.8577948156f, 0.3567584454f, 0,
-    0.5913394901f, -0.548311967f, -0.5913303597f, 0, 0.1204873514f, -0.7626472379f, -0.6354935001f, 0, 0.616959265f, 0.03079647928f, 0.7863922953f, 0, 0.1258156836f, -0.6640829889f, -0.7369967419f, 0, -0.6477565124f, -0.1740147258f, -0.7417077429f, 0, 0.6217889313f, -0.7804430448f, -0.06547655076f, 0, 0.6589943422f, -0.6096987708f, 0.4404473475f, 0, -0.2689837504f, -0.6732403169f, -0.6887635427f, 0,
-    -0.3849775103f, 0.5676542638f, 0.7277093879f, 0, 0.5754444408f, 0.8110471154f, -0.1051963504f, 0, 0.9141593684f, 0.3832947817f, 0.131900567f, 0, -0.107925319f, 0.9245493968f, 0.3654593525f, 0, 0.377977089f, 0.3043148782f, 0.8743716458f, 0, -0.2142885215f, -0.8259286236f, 0.5214617324f, 0, 0.5802544474f, 0.4148098596f, -0.7008834116f, 0, -0.1982660881f, 0.8567161266f, -0.4761596756f, 0,
-    -0.03381553704f, 0.3773180787f, -0.9254661404f, 0, -0.6867922841f, -0.6656597827f, 0.2919133642f, 0, 0.7731742607f, -0.2875793547f, -0.5652430251f, 0, -0.09655941928f, 0.9193708367f, -0.3813575004f, 0, 0.2715702457f, -0.9577909544f, -0.09426605581f, 0, 0.2451015704f, -0.6917998565f, -0.6792188003f, 0, 0.977700782f, -0.1753855374f, 0.1155036542f, 0, -0.5224739938f, 0.8521606816f, 0.02903615945f, 0,
-    -0.7734880599f, -0.5261292347f, 0.3534179531f, 0, -0.7134492443f, -0.269547243f, 0.6467878011f, 0, 0.1644037271f, 0.5105846203f, -0.8439637196f, 0, 0.6494635788f, 0.05585611296f, 0.7583384168f, 0, -0.4711970882f, 0.5017280509f, -0.7254255765f, 0, -0.6335764307f, -0.2381686273f, -0.7361091029f, 0, -0.9021533097f, -0.270947803f, -0.3357181763f, 0, -0.3793711033f, 0.872258117f, 0.3086152025f, 0,
-    -0.6855598966f, -0.3250143309f, 0.6514394162f, 0, 0.2900942212f, -0.7799057743f, -0.5546100667f, 0, -0.2098319339f, 0.85037073f, 0.4825351604f, 0, -0.4592603758f, 0.6598504336f, -0.5947077538f, 0, 0.8715945488f, 0.09616365406f, -0.4807031248f, 0, -0.6776666319f, 0.7118504878f, -0.1844907016f, 0, 0.7044377633f, 0.312427597f, 0.637304036f, 0, -0.7052318886f, -0.2401093292f, -0.6670798253f, 0,
-    0.081921007f, -0.7207336136f, -0.6883545647f, 0, -0.6993680906f, -0.5875763221f, -0.4069869034f, 0, -0.1281454481f, 0.6419895885f, 0.7559286424f, 0, -0.6337388239f, -0.6785471501f, -0.3714146849f, 0, 0.5565051903f, -0.2168887573f, -0.8020356851f, 0, -0.5791554484f, 0.7244372011f, -0.3738578718f, 0, 0.1175779076f, -0.7096451073f, 0.6946792478f, 0, -0.6134619607f, 0.1323631078f, 0.7785527795f, 0,
-    0.6984635305f, -0.02980516237f, -0.715024719f, 0, 0.8318082963f, -0.3930171956f, 0.3919597455f, 0, 0.1469576422f, 0.05541651717f, -0.9875892167f, 0, 0.708868575f, -0.2690503865f, 0.6520101478f, 0, 0.2726053183f, 0.67369766f, -0.68688995f, 0, -0.6591295371f, 0.3035458599f, -0.6880466294f, 0, 0.4815131379f, -0.7528270071f, 0.4487723203f, 0, 0.9430009463f, 0.1675647412f, -0.2875261255f, 0,
-    0.434802957f, 0.7695304522f, -0.4677277752f, 0, 0.3931996188f, 0.594473625f, 0.7014236729f, 0, 0.7254336655f, -0.603925654f, 0.3301814672f, 0, 0.7590235227f, -0.6506083235f, 0.02433313207f, 0, -0.8552768592f, -0.3430042733f, 0.3883935666f, 0, -0.6139746835f, 0.6981725247f, 0.3682257648f, 0, -0.7465905486f, -0.5752009504f, 0.3342849376f, 0, 0.5730065677f, 0.810555537f, -0.1210916791f, 0,
-    -0.9225877367f, -0.3475211012f, -0.167514036f, 0, -0.7105816789f, -0.4719692027f, -0.5218416899f, 0, -0.08564609717f, 0.3583001386f, 0.929669703f, 0, -0.8279697606f, -0.2043157126f, 0.5222271202f, 0, 0.427944023f, 0.278165994f, 0.8599346446f, 0, 0.5399079671f, -0.7857120652f, -0.3019204161f, 0, 0.5678404253f, -0.5495413974f, -0.6128307303f, 0, -0.9896071041f, 0.1365639107f, -0.04503418428f, 0,
-    -0.6154342638f, -0.6440875597f, 0.4543037336f, 0, 0.1074204368f, -0.7946340692f, 0.5975094525f, 0, -0.3595449969f, -0.8885529948f, 0.28495784f, 0, -0.2180405296f, 0.1529888965f, 0.9638738118f, 0, -0.7277432317f, -0.6164050508f, -0.3007234646f, 0, 0.7249729114f, -0.00669719484f, 0.6887448187f, 0, -0.5553659455f, -0.5336586252f, 0.6377908264f, 0, 0.5137558015f, 0.7976208196f, -0.3160000073f, 0,
-    -0.3794024848f, 0.9245608561f, -0.03522751494f, 0, 0.8229248658f, 0.2745365933f, -0.4974176556f, 0, -0.5404114394f, 0.6091141441f, 0.5804613989f, 0, 0.8036581901f, -0.2703029469f, 0.5301601931f, 0, 0.6044318879f, 0.6832968393f, 0.4095943388f, 0, 0.06389988817f, 0.9658208605f, -0.2512108074f, 0, 0.1087113286f, 0.7402471173f, -0.6634877936f, 0, -0.713427712f, -0.6926784018f, 0.1059128479f, 0,
-    0.6458897819f, -0.5724548511f, -0.5050958653f, 0, -0.6553931414f, 0.7381471625f, 0.159995615f, 0, 0.3910961323f, 0.9188871375f, -0.05186755998f, 0, -0.4879022471f, -0.5904376907f, 0.6429111375f, 0, 0.6014790094f, 0.7707441366f, -0.2101820095f, 0, -0.5677173047f, 0.7511360995f, 0.3368851762f, 0, 0.7858573506f, 0.226674665f, 0.5753666838f, 0, -0.4520345543f, -0.604222686f, -0.6561857263f, 0,
-    0.002272116345f, 0.4132844051f, -0.9105991643f, 0, -0.5815751419f, -0.5162925989f, 0.6286591339f, 0, -0.03703704785f, 0.8273785755f, 0.5604221175f, 0, -0.5119692504f, 0.7953543429f, -0.3244980058f, 0, -0.2682417366f, -0.9572290247f, -0.1084387619f, 0, -0.2322482736f, -0.9679131102f, -0.09594243324f, 0, 0.3554328906f, -0.8881505545f, 0.2913006227f, 0, 0.7346520519f, -0.4371373164f, 0.5188422971f, 0,
-    0.9985120116f, 0.04659011161f, -0.02833944577f, 0, -0.3727687496f, -0.9082481361f, 0.1900757285f, 0, 0.91737377f, -0.3483642108f, 0.1925298489f, 0, 0.2714911074f, 0.4147529736f, -0.8684886582f, 0, 0.5131763485f, -0.7116334161f, 0.4798207128f, 0, -0.8737353606f, 0.18886992f, -0.4482350644f, 0, 0.8460043821f, -0.3725217914f, 0.3814499973f, 0, 0.8978727456f, -0.1780209141f, -0.4026575304f, 0,
-    0.2178065647f, -0.9698322841f, -0.1094789531f, 0, -0.1518031304f, -0.7788918132f, -0.6085091231f, 0, -0.2600384876f, -0.4755398075f, -0.8403819825f, 0, 0.572313509f, -0.7474340931f, -0.3373418503f, 0, -0.7174141009f, 0.1699017182f, -0.6756111411f, 0, -0.684180784f, 0.02145707593f, -0.7289967412f, 0, -0.2007447902f, 0.06555605789f, -0.9774476623f, 0, -0.1148803697f, -0.8044887315f, 0.5827524187f, 0,
-    -0.7870349638f, 0.03447489231f, 0.6159443543f, 0, -0.2015596421f, 0.6859872284f, 0.6991389226f, 0, -0.08581082512f, -0.10920836f, -0.9903080513f, 0, 0.5532693395f, 0.7325250401f, -0.396610771f, 0, -0.1842489331f, -0.9777375055f, -0.1004076743f, 0, 0.0775473789f, -0.9111505856f, 0.4047110257f, 0, 0.1399838409f, 0.7601631212f, -0.6344734459f, 0, 0.4484419361f, -0.845289248f, 0.2904925424f, 0
+    static SimdInt SimdFastRound(SimdFloat f) { return FNLSimd::Truncate(f + FNLSimd::Select(f >= 0.0f, FNLSimd::Set(0.5f), FNLSimd::Set(-0.5f))); }
+
+    static SimdFloat SimdLerp(float a, SimdFloat b, float t) { return a + t * (b - a); }
+
+    static SimdFloat SimdPingPong(SimdFloat t)
+    {
+        t = t - FNLSimd::Convert(FNLSimd::Truncate(t * 0.5f) * 2);
+        return FNLSimd::Select(t < 1.0f, t, 2.0f - t);
+    }
+
+    static SimdInt SimdHash(int seed, SimdInt xPrimed, SimdInt yPrimed)
+    {
+        SimdInt hash = FNLSimd::SetI(seed) ^ xPrimed ^ yPrimed;
+
+        return hash * 0x27d4eb2d;
+    }
+
+    static SimdInt SimdHash(int seed, SimdInt xPrimed, SimdInt yPrimed, SimdInt zPrimed)
+    {
+        SimdInt hash = FNLSimd::SetI(seed) ^ xPrimed ^ yPrimed ^ zPrimed;
+
+        return hash * 0x27d4eb2d;
+    }
+
+    static SimdFloat SimdGradCoord(int seed, SimdInt xPrimed, SimdInt yPrimed, SimdFloat xd, SimdFloat yd)
+    {
+        SimdInt hash = SimdHash(seed, xPrimed, yPrimed);
+        hash = hash ^ (hash >> 15);
+        hash = hash & (127 << 1);
+
+        SimdFloat xg = FNLSimd::Gather(Lookup<float>::Gradients2D, hash);
+        SimdFloat yg = FNLSimd::Gather(Lookup<float>::Gradients2D, hash | 1);
+
+        return xd * xg + yd * yg;
+    }
+
+    static SimdFloat SimdGradCoord(int seed, SimdInt xPrimed, SimdInt yPrimed, SimdInt zPrimed, SimdFloat xd, SimdFloat yd, SimdFloat zd)
+    {
+        SimdInt hash = SimdHash(seed, xPrimed, yPrimed, zPrimed);
+        hash = hash ^ (hash >> 15);
+        hash = hash & (63 << 2);
+
+        SimdFloat xg = FNLSimd::Gather(Lookup<float>::Gradients3D, hash);
+        SimdFloat yg = FNLSimd::Gather(Lookup<float>::Gradients3D, hash | 1);
+        SimdFloat zg = FNLSimd::Gather(Lookup<float>::Gradients3D, hash | 2);
+
+        return xd * xg + yd * yg + zd * zg;
+    }
+
+
+    // Batch drivers: apply the coordinate transform, resolve the fractal type once and
+    // run the kernel over full registers, padding the tail
+
+    template <typename Noise>
+    static void SimdBatchLoop(const float* xs, const float* ys, float* out, size_t n, const Noise& noise)
+    {
+        const size_t width = FNLSimd::Width;
+        size_t i = 0;
+
+        for (; i + width <= n; i += width)
+        {
+            FNLSimd::Store(out + i, noise(FNLSimd::Load(xs + i), FNLSimd::Load(ys + i)));
+        }
+
+        if (i < n)
+        {
+            float xt[FNLSimd::Width] = {};
+            float yt[FNLSimd::Width] = {};
+            float ot[FNLSimd::Width];
+
+            for (size_t j = 0; i + j < n; j++)
+            {
+                xt[j] = xs[i + j];
+                yt[j] = ys[i + j];
+            }
+            FNLSimd::Store(ot, noise(FNLSimd::Load(xt), FNLSimd::Load(yt)));
+            for (size_t j = 0; i + j < n; j++)
+            {
+                out[i + j] = ot[j];
+            }
+        }
+    }
+
+    template <typename Noise>
+    static void SimdBatchLoop(const float* xs, const float* ys, const float* zs, float* out, size_t n, const Noise& noise)
+    {
+        const size_t width = FNLSimd::Width;
+        size_t i = 0;
+
+        for (; i + width <= n; i += width)
+        {
+            FNLSimd::Store(out + i, noise(FNLSimd::Load(xs + i), FNLSimd::Load(ys + i), FNLSimd::Load(zs + i)));
+        }
+
+        if (i < n)
+        {
+            float xt[FNLSimd::Width] = {};
+            float yt[FNLSimd::Width] = {};
+            float zt[FNLSimd::Width] = {};
+            float ot[FNLSimd::Width];
+
+            for (size_t j = 0; i + j < n; j++)
+            {
+                xt[j] = xs[i + j];
+                yt[j] = ys[i + j];
+                zt[j] = zs[i + j];
+            }
+            FNLSimd::Store(ot, noise(FNLSimd::Load(xt), FNLSimd::Load(yt), FNLSimd::Load(zt)));
+            for (size_t j = 0; i + j < n; j++)
+            {
+                out[i + j] = ot[j];
+            }
+        }
+    }
+
+    template <bool Skew, typename Kernel>
+    void SimdFractalBatch(const float* xs, const float* ys, float* out, size_t n, const Kernel& kernel) const
+    {
+        auto transformed = [this](auto fractal)
+        {
+            return [this, fractal](SimdFloat x, SimdFloat y)
+            {
+                x = x * mFrequency;
+                y = y * mFrequency;
+
+                if (Skew)
+                {
+                    const float SQRT3 = 1.7320508075688772935274463415059f;
+                    const float F2 = 0.5f * (SQRT3 - 1);
+                    SimdFloat t = (x + y) * F2;
+                    x = x + t;
+                    y = y + t;
+                }
+                return fractal(x, y);
+            };
+        };
+
+        switch (mFractalType)
+        {
+        default:
+            SimdBatchLoop(xs, ys, out, n, transformed([&](SimdFloat x, SimdFloat y) { return kernel(mSeed, x, y); }));
+            break;
+        case FractalType_FBm:
+            SimdBatchLoop(xs, ys, out, n, transformed([&](SimdFloat x, SimdFloat y) { return SimdFractalFBm(kernel, x, y); }));
+            break;
+        case FractalType_Ridged:
+            SimdBatchLoop(xs, ys, out, n, transformed([&](SimdFloat x, SimdFloat y) { return SimdFractalRidged(kernel, x, y); }));
+            break;
+        case FractalType_PingPong:
+            SimdBatchLoop(xs, ys, out, n, transformed([&](SimdFloat x, SimdFloat y) { return SimdFractalPingPong(kernel, x, y); }));
+            break;
+        }
+    }
+
+    template <typename Kernel>
+    void SimdFractalBatch(const float* xs, const float* ys, const float* zs, float* out, size_t n, const Kernel& kernel) const
+    {
+        auto transformed = [this](auto fractal)
+        {
+            return [this, fractal](SimdFloat x, SimdFloat y, SimdFloat z)
+            {
+                SimdTransformNoiseCoordinate(x, y, z);
+                return fractal(x, y, z);
+            };
+        };
+
+        switch (mFractalType)
+        {
+        default:
+            SimdBatchLoop(xs, ys, zs, out, n, transformed([&](SimdFloat x, SimdFloat y, SimdFloat z) { return kernel(mSeed, x, y, z); }));
+            break;
+        case FractalType_FBm:
+            SimdBatchLoop(xs, ys, zs, out, n, transformed([&](SimdFloat x, SimdFloat y, SimdFloat z) { return SimdFractalFBm(kernel, x, y, z); }));
+            break;
+        case FractalType_Ridged:
+            SimdBatchLoop(xs, ys, zs, out, n, transformed([&](SimdFloat x, SimdFloat y, SimdFloat z) { return SimdFractalRidged(kernel, x, y, z); }));
+            break;
+        case FractalType_PingPong:
+            SimdBatchLoop(xs, ys, zs, out, n, transformed([&](SimdFloat x, SimdFloat y, SimdFloat z) { return SimdFractalPingPong(kernel, x, y, z); }));
+            break;
+        }
+    }
+
+    void SimdTransformNoiseCoordinate(SimdFloat& x, SimdFloat& y, SimdFloat& z) const
+    {
+        x = x * mFrequency;
+        y = y * mFrequency;
+        z = z * mFrequency;
+
+        switch (mTransformType3D)
+        {
+        case TransformType3D_ImproveXYPlanes:
+            {
+                SimdFloat xy = x + y;
+                SimdFloat s2 = xy * -0.211324865405187f;
+                z = z * 0.577350269189626f;
+                x = x + (s2 - z);
+                y = y + s2 - z;
+                z = z + xy * 0.577350269189626f;
+            }
+            break;
+        case TransformType3D_ImproveXZPlanes:
+            {
+                SimdFloat xz = x + z;
+                SimdFloat s2 = xz * -0.211324865405187f;
+                y = y * 0.577350269189626f;
+                x = x + (s2 - y);
+                z = z + (s2 - y);
+                y = y + xz * 0.577350269189626f;
+            }
+            break;
+        case TransformType3D_DefaultOpenSimplex2:
+            {
+                const float R3 = (float)(2.0 / 3.0);
+                SimdFloat r = (x + y + z) * R3; // Rotation, not skew
+                x = r - x;
+                y = r - y;
+                z = r - z;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+
+    // SIMD fractals
+
+    template <typename Kernel>
+    SimdFloat SimdFractalFBm(const Kernel& kernel, SimdFloat x, SimdFloat y) const
+    {
+        int seed = mSeed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(mFractalBounding);
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            SimdFloat noise = kernel(seed++, x, y);
+            sum = sum + noise * amp;
+            amp = amp * SimdLerp(1.0f, FNLSimd::Min(noise + 1.0f, FNLSimd::Set(2)) * 0.5f, mWeightedStrength);
+
+            x = x * mLacunarity;
+            y = y * mLacunarity;
+            amp = amp * mGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    SimdFloat SimdFractalFBm(const Kernel& kernel, SimdFloat x, SimdFloat y, SimdFloat z) const
+    {
+        int seed = mSeed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(mFractalBounding);
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            SimdFloat noise = kernel(seed++, x, y, z);
+            sum = sum + noise * amp;
+            amp = amp * SimdLerp(1.0f, (noise + 1.0f) * 0.5f, mWeightedStrength);
+
+            x = x * mLacunarity;
+            y = y * mLacunarity;
+            z = z * mLacunarity;
+            amp = amp * mGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    SimdFloat SimdFractalRidged(const Kernel& kernel, SimdFloat x, SimdFloat y) const
+    {
+        int seed = mSeed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(mFractalBounding);
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            SimdFloat noise = FNLSimd::Abs(kernel(seed++, x, y));
+            sum = sum + (noise * -2.0f + 1.0f) * amp;
+            amp = amp * SimdLerp(1.0f, 1.0f - noise, mWeightedStrength);
+
+            x = x * mLacunarity;
+            y = y * mLacunarity;
+            amp = amp * mGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    SimdFloat SimdFractalRidged(const Kernel& kernel, SimdFloat x, SimdFloat y, SimdFloat z) const
+    {
+        int seed = mSeed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(mFractalBounding);
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            SimdFloat noise = FNLSimd::Abs(kernel(seed++, x, y, z));
+            sum = sum + (noise * -2.0f + 1.0f) * amp;
+            amp = amp * SimdLerp(1.0f, 1.0f - noise, mWeightedStrength);
+
+            x = x * mLacunarity;
+            y = y * mLacunarity;
+            z = z * mLacunarity;
+            amp = amp * mGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    SimdFloat SimdFractalPingPong(const Kernel& kernel, SimdFloat x, SimdFloat y) const
+    {
+        int seed = mSeed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(mFractalBounding);
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            SimdFloat noise = SimdPingPong((kernel(seed++, x, y) + 1.0f) * mPingPongStrength);
+            sum = sum + (noise - 0.5f) * 2.0f * amp;
+            amp = amp * SimdLerp(1.0f, noise, mWeightedStrength);
+
+            x = x * mLacunarity;
+            y = y * mLacunarity;
+            amp = amp * mGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    SimdFloat SimdFractalPingPong(const Kernel& kernel, SimdFloat x, SimdFloat y, SimdFloat z) const
+    {
+        int seed = mSeed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(mFractalBounding);
+
+        for (int i = 0; i < mOctaves; i++)
+        {
+            SimdFloat noise = SimdPingPong((kernel(seed++, x, y, z) + 1.0f) * mPingPongStrength);
+            sum = sum + (noise - 0.5f) * 2.0f * amp;
+            amp = amp * SimdLerp(1.0f, noise, mWeightedStrength);
+
+            x = x * mLacunarity;
+            y = y * mLacunarity;
+            z = z * mLacunarity;
+            amp = amp * mGain;
+        }
+
+        return sum;
+    }
+
+
+    // SIMD OpenSimplex2 Noise
+
+    static SimdFloat SimdSingleSimplex(int seed, SimdFloat x, SimdFloat y)
+    {
+        const float SQRT3 = 1.7320508075688772935274463415059f;
+        const float G2 = (3 - SQRT3) / 6;
+
+        SimdInt i = SimdFastFloor(x);
+        SimdInt j = SimdFastFloor(y);
+        SimdFloat xi = x - FNLSimd::Convert(i);
+        SimdFloat yi = y - FNLSimd::Convert(j);
+
+        SimdFloat t = (xi + yi) * G2;
+        SimdFloat x0 = xi - t;
+        SimdFloat y0 = yi - t;
+
+        i = i * PrimeX;
+        j = j * PrimeY;
+
+        SimdFloat a = 0.5f - x0 * x0 - y0 * y0;
+        SimdFloat n0 = (a > 0.0f) & ((a * a) * (a * a) * SimdGradCoord(seed, i, j, x0, y0));
+
+        SimdFloat c = (float)(2 * (1 - 2 * G2) * (1 / G2 - 2)) * t + ((float)(-2 * (1 - 2 * G2) * (1 - 2 * G2)) + a);
+        SimdFloat x2 = x0 + (2 * (float)G2 - 1);
+        SimdFloat y2 = y0 + (2 * (float)G2 - 1);
+        SimdFloat n2 = (c > 0.0f) & ((c * c) * (c * c) * SimdGradCoord(seed, i + PrimeX, j + PrimeY, x2, y2));
+
+        // Middle vertex of the simplex depends on which half of the skewed cell we are in
+        SimdFloat upper = y0 > x0;
+        SimdFloat x1 = x0 + FNLSimd::Select(upper, FNLSimd::Set((float)G2), FNLSimd::Set((float)G2 - 1));
+        SimdFloat y1 = y0 + FNLSimd::Select(upper, FNLSimd::Set((float)G2 - 1), FNLSimd::Set((float)G2));
+        SimdInt i1 = i + FNLSimd::Select(upper, FNLSimd::SetI(0), FNLSimd::SetI(PrimeX));
+        SimdInt j1 = j + FNLSimd::Select(upper, FNLSimd::SetI(PrimeY), FNLSimd::SetI(0));
+        SimdFloat b = 0.5f - x1 * x1 - y1 * y1;
+        SimdFloat n1 = (b > 0.0f) & ((b * b) * (b * b) * SimdGradCoord(seed, i1, j1, x1, y1));
+
+        return (n0 + n1 + n2) * 99.83685446303647f;
+    }
+
+    static SimdFloat SimdSingleOpenSimplex2(int seed, SimdFloat x, SimdFloat y, SimdFloat z)
+    {
+        SimdInt i = SimdFastRound(x);
+        SimdInt j = SimdFastRound(y);
+        SimdInt k = SimdFastRound(z);
+        SimdFloat x0 = x - FNLSimd::Convert(i);
+        SimdFloat y0 = y - FNLSimd::Convert(j);
+        SimdFloat z0 = z - FNLSimd::Convert(k);
+
+        SimdInt xNSign = FNLSimd::Truncate(-1.0f - x0) | 1;
+        SimdInt yNSign = FNLSimd::Truncate(-1.0f - y0) | 1;
+        SimdInt zNSign = FNLSimd::Truncate(-1.0f - z0) | 1;
+
+        SimdFloat ax0 = FNLSimd::Convert(xNSign) * -x0;
+        SimdFloat ay0 = FNLSimd::Convert(yNSign) * -y0;
+        SimdFloat az0 = FNLSimd::Convert(zNSign) * -z0;
+
+        i = i * PrimeX;
+        j = j * PrimeY;
+        k = k * PrimeZ;
+
+        SimdFloat value = FNLSimd::Set(0);
+        SimdFloat a = (0.6f - x0 * x0) - (y0 * y0 + z0 * z0);
+
+        for (int l = 0; ; l++)
+        {
+            value = value + ((a > 0.0f) & ((a * a) * (a * a) * SimdGradCoord(seed, i, j, k, x0, y0, z0)));
+
+            SimdFloat xSign = FNLSimd::Convert(xNSign);
+            SimdFloat ySign = FNLSimd::Convert(yNSign);
+            SimdFloat zSign = FNLSimd::Convert(zNSign);
+
+            // Step along the axis furthest from the origin, same priority as the scalar branches
+            SimdFloat stepX = (ax0 >= ay0) & (ax0 >= az0);
+            SimdFloat stepY = FNLSimd::AndNot(stepX, (ay0 > ax0) & (ay0 >= az0));
+            SimdFloat stepXY = stepX | stepY;
+
+            SimdFloat x1 = x0 + (stepX & xSign);
+            SimdFloat y1 = y0 + (stepY & ySign);
+            SimdFloat z1 = z0 + FNLSimd::AndNot(stepXY, zSign);
+
+            SimdFloat b = (a + 1.0f) - FNLSimd::Select(stepX, xSign * 2.0f * x1,
+                FNLSimd::Select(stepY, ySign * 2.0f * y1, zSign * 2.0f * z1));
+
+            SimdInt i1 = i - FNLSimd::Select(stepX, xNSign * PrimeX, FNLSimd::SetI(0));
+            SimdInt j1 = j - FNLSimd::Select(stepY, yNSign * PrimeY, FNLSimd::SetI(0));
+            SimdInt k1 = k - FNLSimd::Select(stepXY, FNLSimd::SetI(0), zNSign * PrimeZ);
+
+            value = value + ((b > 0.0f) & ((b * b) * (b * b) * SimdGradCoord(seed, i1, j1, k1, x1, y1, z1)));
+
+            if (l == 1) break;
+
+            ax0 = 0.5f - ax0;
+            ay0 = 0.5f - ay0;
+            az0 = 0.5f - az0;
+
+            x0 = xSign * ax0;
+            y0 = ySign * ay0;
+            z0 = zSign * az0;
+
+            a = a + ((0.75f - ax0) - (ay0 + az0));
+
+            i = i + ((xNSign >> 1) & PrimeX);
+            j = j + ((yNSign >> 1) & PrimeY);
+            k = k + ((zNSign >> 1) & PrimeZ);
+
+            xNSign = -xNSign;
+            yNSign = -yNSign;
+            zNSign = -zNSign;
+
+            seed = ~seed;
+        }
+
+        return value * 32.69428253173828125f;
+    }
+
+
+    // SIMD Cellular Noise
+
+    template <CellularDistanceFunction DistanceFunction>
+    static SimdFloat SimdCellularDistance(SimdFloat vecX, SimdFloat vecY)
+    {
+        switch (DistanceFunction)
+        {
+        case CellularDistanceFunction_Manhattan:
+            return FNLSimd::Abs(vecX) + FNLSimd::Abs(vecY);
+        case CellularDistanceFunction_Hybrid:
+            return (FNLSimd::Abs(vecX) + FNLSimd::Abs(vecY)) + (vecX * vecX + vecY * vecY);
+        default:
+            return vecX * vecX + vecY * vecY;
+        }
+    }
+
+    template <CellularDistanceFunction DistanceFunction>
+    static SimdFloat SimdCellularDistance(SimdFloat vecX, SimdFloat vecY, SimdFloat vecZ)
+    {
+        switch (DistanceFunction)
+        {
+        case CellularDistanceFunction_Manhattan:
+            return FNLSimd::Abs(vecX) + FNLSimd::Abs(vecY) + FNLSimd::Abs(vecZ);
+        case CellularDistanceFunction_Hybrid:
+            return (FNLSimd::Abs(vecX) + FNLSimd::Abs(vecY) + FNLSimd::Abs(vecZ)) + (vecX * vecX + vecY * vecY + vecZ * vecZ);
+        default:
+            return vecX * vecX + vecY * vecY + vecZ * vecZ;
+        }
+    }
+
+    SimdFloat SimdCellularReturn(SimdFloat distance0, SimdFloat distance1, SimdInt closestHash) const
+    {
+        if (mCellularDistanceFunction == CellularDistanceFunction_Euclidean && mCellularReturnType >= CellularReturnType_Distance)
+        {
+            distance0 = FNLSimd::Sqrt(distance0);
+
+            if (mCellularReturnType >= CellularReturnType_Distance2)
+            {
+                distance1 = FNLSimd::Sqrt(distance1);
+            }
+        }
+
+        switch (mCellularReturnType)
+        {
+        case CellularReturnType_CellValue:
+            return FNLSimd::Convert(closestHash) * (1 / 2147483648.0f);
+        case CellularReturnType_Distance:
+            return distance0 - 1.0f;
+        case CellularReturnType_Distance2:
+            return distance1 - 1.0f;
+        case CellularReturnType_Distance2Add:
+            return (distance1 + distance0) * 0.5f - 1.0f;
+        case CellularReturnType_Distance2Sub:
+            return distance1 - distance0 - 1.0f;
+        case CellularReturnType_Distance2Mul:
+            return distance1 * distance0 * 0.5f - 1.0f;
+        case CellularReturnType_Distance2Div:
+            return distance0 / distance1 - 1.0f;
+        default:
+            return FNLSimd::Set(0);
+        }
+    }
+
+    template <CellularDistanceFunction DistanceFunction>
+    SimdFloat SimdSingleCellular(int seed, SimdFloat x, SimdFloat y) const
+    {
+        SimdInt xr = SimdFastRound(x);
+        SimdInt yr = SimdFastRound(y);
+
+        SimdFloat distance0 = FNLSimd::Set(1e10f);
+        SimdFloat distance1 = FNLSimd::Set(1e10f);
+        SimdInt closestHash = FNLSimd::SetI(0);
+
+        float cellularJitter = 0.43701595f * mCellularJitterModifier;
+
+        SimdInt xPrimed = (xr - 1) * PrimeX;
+        SimdInt yPrimedBase = (yr - 1) * PrimeY;
+
+        for (int xi = -1; xi <= 1; xi++)
+        {
+            SimdInt yPrimed = yPrimedBase;
+            SimdFloat xd = FNLSimd::Convert(xr + xi) - x;
+
+            for (int yi = -1; yi <= 1; yi++)
+            {
+                SimdInt hash = SimdHash(seed, xPrimed, yPrimed);
+                SimdInt idx = hash & (255 << 1);
+
+                SimdFloat vecX = xd + FNLSimd::Gather(Lookup<float>::RandVecs2D, idx) * cellularJitter;
+                SimdFloat vecY = (FNLSimd::Convert(yr + yi) - y) + FNLSimd::Gather(Lookup<float>::RandVecs2D, idx | 1) * cellularJitter;
+
+                SimdFloat newDistance = SimdCellularDistance<DistanceFunction>(vecX, vecY);
+
+                distance1 = FNLSimd::Max(FNLSimd::Min(distance1, newDistance), distance0);
+                SimdFloat closer = newDistance < distance0;
+                distance0 = FNLSimd::Select(closer, newDistance, distance0);
+                closestHash = FNLSimd::Select(closer, hash, closestHash);
+
+                yPrimed = yPrimed + PrimeY;
+            }
+            xPrimed = xPrimed + PrimeX;
+        }
+
+        return SimdCellularReturn(distance0, distance1, closestHash);
+    }
+
+    template <CellularDistanceFunction DistanceFunction>
+    SimdFloat SimdSingleCellular(int seed, SimdFloat x, SimdFloat y, SimdFloat z) const
+    {
+        SimdInt xr = SimdFastRound(x);
+        SimdInt yr = SimdFastRound(y);
+        SimdInt zr = SimdFastRound(z);
+
+        SimdFloat distance0 = FNLSimd::Set(1e10f);
+        SimdFloat distance1 = FNLSimd::Set(1e10f);
+        SimdInt closestHash = FNLSimd::SetI(0);
+
+        float cellularJitter = 0.39614353f * mCellularJitterModifier;
+
+        SimdInt xPrimed = (xr - 1) * PrimeX;
+        SimdInt yPrimedBase = (yr - 1) * PrimeY;
+        SimdInt zPrimedBase = (zr - 1) * PrimeZ;
+
+        for (int xi = -1; xi <= 1; xi++)
+        {
+            SimdInt yPrimed = yPrimedBase;
+            SimdFloat xd = FNLSimd::Convert(xr + xi) - x;
+
+            for (int yi = -1; yi <= 1; yi++)
+            {
+                SimdInt zPrimed = zPrimedBase;
+                SimdFloat yd = FNLSimd::Convert(yr + yi) - y;
+
+                for (int zi = -1; zi <= 1; zi++)
+                {
+                    SimdInt hash = SimdHash(seed, xPrimed, yPrimed, zPrimed);
+                    SimdInt idx = hash & (255 << 2);
+
+                    SimdFloat vecX = xd + FNLSimd::Gather(Lookup<float>::RandVecs3D, idx) * cellularJitter;
+                    SimdFloat vecY = yd + FNLSimd::Gather(Lookup<float>::RandVecs3D, idx | 1) * cellularJitter;
+                    SimdFloat vecZ = (FNLSimd::Convert(zr + zi) - z) + FNLSimd::Gather(Lookup<float>::RandVecs3D, idx | 2) * cellularJitter;
+
+                    SimdFloat newDistance = SimdCellularDistance<DistanceFunction>(vecX, vecY, vecZ);
+
+                    distance1 = FNLSimd::Max(FNLSimd::Min(distance1, newDistance), distance0);
+                    SimdFloat closer = newDistance < distance0;
+                    distance0 = FNLSimd::Select(closer, newDistance, distance0);
+                    closestHash = FNLSimd::Select(closer, hash, closestHash);
+
+                    zPrimed = zPrimed + PrimeZ;
+                }
+                yPrimed = yPrimed + PrimeY;
+            }
+            xPrimed = xPrimed + PrimeX;
+        }
+
+        return SimdCellularReturn(distance0, distance1, closestHash);
+    }
+
+
+    // SIMD Cellular Noise, fixed settings
+
+    // Feature point offsets for one jitter value, RandVecs with the jitter already applied.
+    // reach is the largest offset component: no feature point strays further than that from its cell center
+    struct SimdCellularTable
+    {
+        alignas(64) float vecs2D[256 * 2];
+        alignas(64) float vecs3D[256 * 4];
+        float reach2D = 0;
+        float reach3D = 0;
+
+        explicit SimdCellularTable(float jitterModifier)
+        {
+            float jitter2D = 0.43701595f * jitterModifier;
+            float jitter3D = 0.39614353f * jitterModifier;
+
+            for (int i = 0; i < 256 * 2; i++)
+            {
+                vecs2D[i] = Lookup<float>::RandVecs2D[i] * jitter2D;
+                reach2D = FastMax(reach2D, FastAbs(vecs2D[i]));
+            }
+            for (int i = 0; i < 256 * 4; i++)
+            {
+                vecs3D[i] = Lookup<float>::RandVecs3D[i] * jitter3D;
+                reach3D = FastMax(reach3D, FastAbs(vecs3D[i]));
+            }
+        }
+    };
+
+    // Closest a feature point of a cell can get along one axis, given the cell center offset
+    static SimdFloat SimdCellularAxisBound(SimdFloat centerOffset, float reach)
+    {
+        return FNLSimd::Max(FNLSimd::Abs(centerOffset) - reach, FNLSimd::Set(0));
+    }
+
+    template <CellularDistanceFunction DistanceFunction, CellularReturnType ReturnType>
+    static SimdFloat SimdCellularReturnFixed(SimdFloat distance0, SimdFloat distance1, SimdInt closestHash)
+    {
+        if constexpr (DistanceFunction == CellularDistanceFunction_Euclidean && ReturnType >= CellularReturnType_Distance)
+        {
+            distance0 = FNLSimd::Sqrt(distance0);
+
+            if constexpr (ReturnType >= CellularReturnType_Distance2)
+            {
+                distance1 = FNLSimd::Sqrt(distance1);
+            }
+        }
+
+        if constexpr (ReturnType == CellularReturnType_CellValue)
+            return FNLSimd::Convert(closestHash) * (1 / 2147483648.0f);
+        else if constexpr (ReturnType == CellularReturnType_Distance)
+            return distance0 - 1.0f;
+        else if constexpr (ReturnType == CellularReturnType_Distance2)
+            return distance1 - 1.0f;
+        else if constexpr (ReturnType == CellularReturnType_Distance2Add)
+            return (distance1 + distance0) * 0.5f - 1.0f;
+        else if constexpr (ReturnType == CellularReturnType_Distance2Sub)
+            return distance1 - distance0 - 1.0f;
+        else if constexpr (ReturnType == CellularReturnType_Distance2Mul)
+            return distance1 * distance0 * 0.5f - 1.0f;
+        else if constexpr (ReturnType == CellularReturnType_Distance2Div)
+            return distance0 / distance1 - 1.0f;
+        else
+            return FNLSimd::Set(0);
+    }
+
+    // Same result as SimdSingleCellular, up to ties between equally distant points. Cells are visited
+    // center first, and a neighbour column or cell is skipped when, for every lane, even its closest
+    // possible feature point could not beat the distance the return type still depends on
+    template <CellularDistanceFunction DistanceFunction, CellularReturnType ReturnType>
+    static SimdFloat SimdSingleCellularFast(int seed, SimdFloat x, SimdFloat y, const SimdCellularTable& table)
+    {
+        static constexpr int Order[3] = { 0, -1, 1 };
+        static constexpr bool UsesDistance1 = ReturnType >= CellularReturnType_Distance2;
+
+        SimdInt xr = SimdFastRound(x);
+        SimdInt yr = SimdFastRound(y);
+
+        SimdFloat distance0 = FNLSimd::Set(1e10f);
+        SimdFloat distance1 = FNLSimd::Set(1e10f);
+        SimdInt closestHash = FNLSimd::SetI(0);
+
+        SimdInt xPrimedBase = xr * PrimeX;
+        SimdInt yPrimedBase = yr * PrimeY;
+
+        for (int xi : Order)
+        {
+            SimdFloat xd = FNLSimd::Convert(xr + xi) - x;
+            SimdFloat xBound = SimdCellularAxisBound(xd, table.reach2D);
+
+            if (xi != 0 && FNLSimd::All(SimdCellularDistance<DistanceFunction>(xBound, FNLSimd::Set(0)) >= (UsesDistance1 ? distance1 : distance0)))
+                continue;
+
+            SimdInt xPrimed = xPrimedBase + xi * PrimeX;
+
+            for (int yi : Order)
+            {
+                SimdFloat yd = FNLSimd::Convert(yr + yi) - y;
+
+                if ((xi | yi) != 0)
+                {
+                    SimdFloat bound = SimdCellularDistance<DistanceFunction>(xBound, SimdCellularAxisBound(yd, table.reach2D));
+                    if (FNLSimd::All(bound >= (UsesDistance1 ? distance1 : distance0)))
+                        continue;
+                }
+
+                SimdInt hash = SimdHash(seed, xPrimed, yPrimedBase + yi * PrimeY);
+                SimdInt idx = hash & (255 << 1);
+
+                SimdFloat vecX = xd + FNLSimd::Gather(table.vecs2D, idx);
+                SimdFloat vecY = yd + FNLSimd::Gather(table.vecs2D, idx | 1);
+
+                SimdFloat newDistance = SimdCellularDistance<DistanceFunction>(vecX, vecY);
+
+                if constexpr (UsesDistance1)
+                {
+                    distance1 = FNLSimd::Max(FNLSimd::Min(distance1, newDistance), distance0);
+                }
+                SimdFloat closer = newDistance < distance0;
+                distance0 = FNLSimd::Select(closer, newDistance, distance0);
+                if constexpr (ReturnType == CellularReturnType_CellValue)
+                {
+                    closestHash = FNLSimd::Select(closer, hash, closestHash);
+                }
+            }
+        }
+
+        return SimdCellularReturnFixed<DistanceFunction, ReturnType>(distance0, distance1, closestHash);
+    }
+
+    template <CellularDistanceFunction DistanceFunction, CellularReturnType ReturnType>
+    static SimdFloat SimdSingleCellularFast(int seed, SimdFloat x, SimdFloat y, SimdFloat z, const SimdCellularTable& table)
+    {
+        static constexpr int Order[3] = { 0, -1, 1 };
+        static constexpr bool UsesDistance1 = ReturnType >= CellularReturnType_Distance2;
+
+        SimdInt xr = SimdFastRound(x);
+        SimdInt yr = SimdFastRound(y);
+        SimdInt zr = SimdFastRound(z);
+
+        SimdFloat distance0 = FNLSimd::Set(1e10f);
+        SimdFloat distance1 = FNLSimd::Set(1e10f);
+        SimdInt closestHash = FNLSimd::SetI(0);
+
+        SimdInt xPrimedBase = xr * PrimeX;
+        SimdInt yPrimedBase = yr * PrimeY;
+        SimdInt zPrimedBase = zr * PrimeZ;
+
+        for (int xi : Order)
+        {
+            SimdFloat xd = FNLSimd::Convert(xr + xi) - x;
+            SimdFloat xBound = SimdCellularAxisBound(xd, table.reach3D);
+
+            if (xi != 0 && FNLSimd::All(SimdCellularDistance<DistanceFunction>(xBound, FNLSimd::Set(0), FNLSimd::Set(0)) >= (UsesDistance1 ? distance1 : distance0)))
+                continue;
+
+            SimdInt xPrimed = xPrimedBase + xi * PrimeX;
+
+            for (int yi : Order)
+            {
+                SimdFloat yd = FNLSimd::Convert(yr + yi) - y;
+                SimdFloat yBound = SimdCellularAxisBound(yd, table.reach3D);
+
+                if (yi != 0 && FNLSimd::All(SimdCellularDistance<DistanceFunction>(xBound, yBound, FNLSimd::Set(0)) >= (UsesDistance1 ? distance1 : distance0)))
+                    continue;
+
+                SimdInt yPrimed = yPrimedBase + yi * PrimeY;
+
+                for (int zi : Order)
+                {
+                    SimdFloat zd = FNLSimd::Convert(zr + zi) - z;
+
+                    if ((xi | yi | zi) != 0)
+                    {
+                        SimdFloat bound = SimdCellularDistance<DistanceFunction>(xBound, yBound, SimdCellularAxisBound(zd, table.reach3D));
+                        if (FNLSimd::All(bound >= (UsesDistance1 ? distance1 : distance0)))
+                            continue;
+                    }
+
+                    SimdInt hash = SimdHash(seed, xPrimed, yPrimed, zPrimedBase + zi * PrimeZ);
+                    SimdInt idx = hash & (255 << 2);
+
+                    SimdFloat vecX = xd + FNLSimd::Gather(table.vecs3D, idx);
+                    SimdFloat vecY = yd + FNLSimd::Gather(table.vecs3D, idx | 1);
+                    SimdFloat vecZ = zd + FNLSimd::Gather(table.vecs3D, idx | 2);
+
+                    SimdFloat newDistance = SimdCellularDistance<DistanceFunction>(vecX, vecY, vecZ);
+
+                    if constexpr (UsesDistance1)
+                    {
+                        distance1 = FNLSimd::Max(FNLSimd::Min(distance1, newDistance), distance0);
+                    }
+                    SimdFloat closer = newDistance < distance0;
+                    distance0 = FNLSimd::Select(closer, newDistance, distance0);
+                    if constexpr (ReturnType == CellularReturnType_CellValue)
+                    {
+                        closestHash = FNLSimd::Select(closer, hash, closestHash);
+                    }
+                }
+            }
+        }
+
+        return SimdCellularReturnFixed<DistanceFunction, ReturnType>(distance0, distance1, closestHash);
+    }
+#endif
+};
+
+template <>
+struct FastNoiseLite::Arguments_must_be_floating_point_values<float> {};
+template <>
+struct FastNoiseLite::Arguments_must_be_floating_point_values<double> {};
+template <>
+struct FastNoiseLite::Arguments_must_be_floating_point_values<long double> {};
+
+template <typename T>
+const T FastNoiseLite::Lookup<T>::Gradients2D[] =
+{
+    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+    0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+    0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+    0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+    -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+    -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+    -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+    0.38268343236509f, 0.923879532511287f, 0.923879532511287f, 0.38268343236509f, 0.923879532511287f, -0.38268343236509f, 0.38268343236509f, -0.923879532511287f,
+    -0.38268343236509f, -0.923879532511287f, -0.923879532511287f, -0.38268343236509f, -0.923879532511287f, 0.38268343236509f, -0.38268343236509f, 0.923879532511287f,
+};
+
+template <typename T>
+const T FastNoiseLite::Lookup<T>::RandVecs2D[] =
+{
+    -0.2700222198f, -0.9628540911f, 0.3863092627f, -0.9223693152f, 0.04444859006f, -0.999011673f, -0.5992523158f, -0.8005602176f, -0.7819280288f, 0.6233687174f, 0.9464672271f, 0.3227999196f, -0.6514146797f, -0.7587218957f, 0.9378472289f, 0.347048376f,
+    -0.8497875957f, -0.5271252623f, -0.879042592f, 0.4767432447f, -0.892300288f, -0.4514423508f, -0.379844434f, -0.9250503802f, -0.9951650832f, 0.0982163789f, 0.7724397808f, -0.6350880136f, 0.7573283322f, -0.6530343002f, -0.9928004525f, -0.119780055f,
+    -0.0532665713f, 0.9985803285f, 0.9754253726f, -0.2203300762f, -0.7665018163f, 0.6422421394f, 0.991636706f, 0.1290606184f, -0.994696838f, 0.1028503788f, -0.5379205513f, -0.84299554f, 0.5022815471f, -0.8647041387f, 0.4559821461f, -0.8899889226f,
+    -0.8659131224f, -0.5001944266f, 0.0879458407f, -0.9961252577f, -0.5051684983f, 0.8630207346f, 0.7753185226f, -0.6315704146f, -0.6921944612f, 0.7217110418f, -0.5191659449f, -0.8546734591f, 0.8978622882f, -0.4402764035f, -0.1706774107f, 0.9853269617f,
+    -0.9353430106f, -0.3537420705f, -0.9992404798f, 0.03896746794f, -0.2882064021f, -0.9575683108f, -0.9663811329f, 0.2571137995f, -0.8759714238f, -0.4823630009f, -0.8303123018f, -0.5572983775f, 0.05110133755f, -0.9986934731f, -0.8558373281f, -0.5172450752f,
+    0.09887025282f, 0.9951003332f, 0.9189016087f, 0.3944867976f, -0.2439375892f, -0.9697909324f, -0.8121409387f, -0.5834613061f, -0.9910431363f, 0.1335421355f, 0.8492423985f, -0.5280031709f, -0.9717838994f, -0.2358729591f, 0.9949457207f, 0.1004142068f,
+    0.6241065508f, -0.7813392434f, 0.662910307f, 0.7486988212f, -0.7197418176f, 0.6942418282f, -0.8143370775f, -0.5803922158f, 0.104521054f, -0.9945226741f, -0.1065926113f, -0.9943027784f, 0.445799684f, -0.8951327509f, 0.105547406f, 0.9944142724f,
+    -0.992790267f, 0.1198644477f, -0.8334366408f, 0.552615025f, 0.9115561563f, -0.4111755999f, 0.8285544909f, -0.5599084351f, 0.7217097654f, -0.6921957921f, 0.4940492677f, -0.8694339084f, -0.3652321272f, -0.9309164803f, -0.9696606758f, 0.2444548501f,
+    0.08925509731f, -0.996008799f, 0.5354071276f, -0.8445941083f, -0.1053576186f, 0.9944343981f, -0.9890284586f, 0.1477251101f, 0.004856104961f, 0.9999882091f, 0.9885598478f, 0.1508291331f, 0.9286129562f, -0.3710498316f, -0.5832393863f, -0.8123003252f,
+    0.3015207509f, 0.9534596146f, -0.9575110528f, 0.2883965738f, 0.9715802154f, -0.2367105511f, 0.229981792f, 0.9731949318f, 0.955763816f, -0.2941352207f, 0.740956116f, 0.6715534485f, -0.9971513787f, -0.07542630764f, 0.6905710663f, -0.7232645452f,
+    -0.290713703f, -0.9568100872f, 0.5912777791f, -0.8064679708f, -0.9454592212f, -0.325740481f, 0.6664455681f, 0.74555369f, 0.6236134912f, 0.7817328275f, 0.9126993851f, -0.4086316587f, -0.8191762011f, 0.5735419353f, -0.8812745759f, -0.4726046147f,
+    0.9953313627f, 0.09651672651f, 0.9855650846f, -0.1692969699f, -0.8495980887f, 0.5274306472f, 0.6174853946f, -0.7865823463f, 0.8508156371f, 0.52546432f, 0.9985032451f, -0.05469249926f, 0.1971371563f, -0.9803759185f, 0.6607855748f, -0.7505747292f,
+    -0.03097494063f, 0.9995201614f, -0.6731660801f, 0.739491331f, -0.7195018362f, -0.6944905383f, 0.9727511689f, 0.2318515979f, 0.9997059088f, -0.0242506907f, 0.4421787429f, -0.8969269532f, 0.9981350961f, -0.061043673f, -0.9173660799f, -0.3980445648f,
+    -0.8150056635f, -0.5794529907f, -0.8789331304f, 0.4769450202f, 0.0158605829f, 0.999874213f, -0.8095464474f, 0.5870558317f, -0.9165898907f, -0.3998286786f, -0.8023542565f, 0.5968480938f, -0.5176737917f, 0.8555780767f, -0.8154407307f, -0.5788405779f,
+    0.4022010347f, -0.9155513791f, -0.9052556868f, -0.4248672045f, 0.7317445619f, 0.6815789728f, -0.5647632201f, -0.8252529947f, -0.8403276335f, -0.5420788397f, -0.9314281527f, 0.363925262f, 0.5238198472f, 0.8518290719f, 0.7432803869f, -0.6689800195f,
+    -0.985371561f, -0.1704197369f, 0.4601468731f, 0.88784281f, 0.825855404f, 0.5638819483f, 0.6182366099f, 0.7859920446f, 0.8331502863f, -0.553046653f, 0.1500307506f, 0.9886813308f, -0.662330369f, -0.7492119075f, -0.668598664f, 0.743623444f,
+    0.7025606278f, 0.7116238924f, -0.5419389763f, -0.8404178401f, -0.3388616456f, 0.9408362159f, 0.8331530315f, 0.5530425174f, -0.2989720662f, -0.9542618632f, 0.2638522993f, 0.9645630949f, 0.124108739f, -0.9922686234f, -0.7282649308f, -0.6852956957f,
+    0.6962500149f, 0.7177993569f, -0.9183535368f, 0.3957610156f, -0.6326102274f, -0.7744703352f, -0.9331891859f, -0.359385508f, -0.1153779357f, -0.9933216659f, 0.9514974788f, -0.3076565421f, -0.08987977445f, -0.9959526224f, 0.6678496916f, 0.7442961705f,
+    0.7952400393f, -0.6062947138f, -0.6462007402f, -0.7631674805f, -0.2733598753f, 0.9619118351f, 0.9669590226f, -0.254931851f, -0.9792894595f, 0.2024651934f, -0.5369502995f, -0.8436138784f, -0.270036471f, -0.9628500944f, -0.6400277131f, 0.7683518247f,
+    -0.7854537493f, -0.6189203566f, 0.06005905383f, -0.9981948257f, -0.02455770378f, 0.9996984141f, -0.65983623f, 0.751409442f, -0.6253894466f, -0.7803127835f, -0.6210408851f, -0.7837781695f, 0.8348888491f, 0.5504185768f, -0.1592275245f, 0.9872419133f,
+    0.8367622488f, 0.5475663786f, -0.8675753916f, -0.4973056806f, -0.2022662628f, -0.9793305667f, 0.9399189937f, 0.3413975472f, 0.9877404807f, -0.1561049093f, -0.9034455656f, 0.4287028224f, 0.1269804218f, -0.9919052235f, -0.3819600854f, 0.924178821f,
+    0.9754625894f, 0.2201652486f, -0.3204015856f, -0.9472818081f, -0.9874760884f, 0.1577687387f, 0.02535348474f, -0.9996785487f, 0.4835130794f, -0.8753371362f, -0.2850799925f, -0.9585037287f, -0.06805516006f, -0.99768156f, -0.7885244045f, -0.6150034663f,
+    0.3185392127f, -0.9479096845f, 0.8880043089f, 0.4598351306f, 0.6476921488f, -0.7619021462f, 0.9820241299f, 0.1887554194f, 0.9357275128f, -0.3527237187f, -0.8894895414f, 0.4569555293f, 0.7922791302f, 0.6101588153f, 0.7483818261f, 0.6632681526f,
+    -0.7288929755f, -0.6846276581f, 0.8729032783f, -0.4878932944f, 0.8288345784f, 0.5594937369f, 0.08074567077f, 0.9967347374f, 0.9799148216f, -0.1994165048f, -0.580730673f, -0.8140957471f, -0.4700049791f, -0.8826637636f, 0.2409492979f, 0.9705377045f,
+    0.9437816757f, -0.3305694308f, -0.8927998638f, -0.4504535528f, -0.8069622304f, 0.5906030467f, 0.06258973166f, 0.9980393407f, -0.9312597469f, 0.3643559849f, 0.5777449785f, 0.8162173362f, -0.3360095855f, -0.941858566f, 0.697932075f, -0.7161639607f,
+    -0.002008157227f, -0.9999979837f, -0.1827294312f, -0.9831632392f, -0.6523911722f, 0.7578824173f, -0.4302626911f, -0.9027037258f, -0.9985126289f, -0.05452091251f, -0.01028102172f, -0.9999471489f, -0.4946071129f, 0.8691166802f, -0.2999350194f, 0.9539596344f,
+    0.8165471961f, 0.5772786819f, 0.2697460475f, 0.962931498f, -0.7306287391f, -0.6827749597f, -0.7590952064f, -0.6509796216f, -0.907053853f, 0.4210146171f, -0.5104861064f, -0.8598860013f, 0.8613350597f, 0.5080373165f, 0.5007881595f, -0.8655698812f,
+    -0.654158152f, 0.7563577938f, -0.8382755311f, -0.545246856f, 0.6940070834f, 0.7199681717f, 0.06950936031f, 0.9975812994f, 0.1702942185f, -0.9853932612f, 0.2695973274f, 0.9629731466f, 0.5519612192f, -0.8338697815f, 0.225657487f, -0.9742067022f,
+    0.4215262855f, -0.9068161835f, 0.4881873305f, -0.8727388672f, -0.3683854996f, -0.9296731273f, -0.9825390578f, 0.1860564427f, 0.81256471f, 0.5828709909f, 0.3196460933f, -0.9475370046f, 0.9570913859f, 0.2897862643f, -0.6876655497f, -0.7260276109f,
+    -0.9988770922f, -0.047376731f, -0.1250179027f, 0.992154486f, -0.8280133617f, 0.560708367f, 0.9324863769f, -0.3612051451f, 0.6394653183f, 0.7688199442f, -0.01623847064f, -0.9998681473f, -0.9955014666f, -0.09474613458f, -0.81453315f, 0.580117012f,
+    0.4037327978f, -0.9148769469f, 0.9944263371f, 0.1054336766f, -0.1624711654f, 0.9867132919f, -0.9949487814f, -0.100383875f, -0.6995302564f, 0.7146029809f, 0.5263414922f, -0.85027327f, -0.5395221479f, 0.841971408f, 0.6579370318f, 0.7530729462f,
+    0.01426758847f, -0.9998982128f, -0.6734383991f, 0.7392433447f, 0.639412098f, -0.7688642071f, 0.9211571421f, 0.3891908523f, -0.146637214f, -0.9891903394f, -0.782318098f, 0.6228791163f, -0.5039610839f, -0.8637263605f, -0.7743120191f, -0.6328039957f,
+};
+
+template <typename T>
+const T FastNoiseLite::Lookup<T>::Gradients3D[] =
+{
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    1, 1, 0, 0,  0,-1, 1, 0, -1, 1, 0, 0,  0,-1,-1, 0
+};
+
+template <typename T>
+const T FastNoiseLite::Lookup<T>::RandVecs3D[] =
+{
+    -0.7292736885f, -0.6618439697f, 0.1735581948f, 0, 0.790292081f, -0.5480887466f, -0.2739291014f, 0, 0.7217578935f, 0.6226212466f, -0.3023380997f, 0, 0.565683137f, -0.8208298145f, -0.0790000257f, 0, 0.760049034f, -0.5555979497f, -0.3370999617f, 0, 0.3713945616f, 0.5011264475f, 0.7816254623f, 0, -0.1277062463f, -0.4254438999f, -0.8959289049f, 0, -0.2881560924f, -0.5815838982f, 0.7607405838f, 0,
+    0.5849561111f, -0.662820239f, -0.4674352136f, 0, 0.3307171178f, 0.0391653737f, 0.94291689f, 0, 0.8712121778f, -0.4113374369f, -0.2679381538f, 0, 0.580981015f, 0.7021915846f, 0.4115677815f, 0, 0.503756873f, 0.6330056931f, -0.5878203852f, 0, 0.4493712205f, 0.601390195f, 0.6606022552f, 0, -0.6878403724f, 0.09018890807f, -0.7202371714f, 0, -0.5958956522f, -0.6469350577f, 0.475797649f, 0,
+    -0.5127052122f, 0.1946921978f, -0.8361987284f, 0, -0.9911507142f, -0.05410276466f, -0.1212153153f, 0, -0.2149721042f, 0.9720882117f, -0.09397607749f, 0, -0.7518650936f, -0.5428057603f, 0.3742469607f, 0, 0.5237068895f, 0.8516377189f, -0.02107817834f, 0, 0.6333504779f, 0.1926167129f, -0.7495104896f, 0, -0.06788241606f, 0.3998305789f, 0.9140719259f, 0, -0.5538628599f, -0.4729896695f, -0.6852128902f, 0,
+    -0.7261455366f, -0.5911990757f, 0.3509933228f, 0, -0.9229274737f, -0.1782808786f, 0.3412049336f, 0, -0.6968815002f, 0.6511274338f, 0.3006480328f, 0, 0.9608044783f, -0.2098363234f, -0.1811724921f, 0, 0.06817146062f, -0.9743405129f, 0.2145069156f, 0, -0.3577285196f, -0.6697087264f, -0.6507845481f, 0, -0.1868621131f, 0.7648617052f, -0.6164974636f, 0, -0.6541697588f, 0.3967914832f, 0.6439087246f, 0,
+    0.6993340405f, -0.6164538506f, 0.3618239211f, 0, -0.1546665739f, 0.6291283928f, 0.7617583057f, 0, -0.6841612949f, -0.2580482182f, -0.6821542638f, 0, 0.5383980957f, 0.4258654885f, 0.7271630328f, 0, -0.5026987823f, -0.7939832935f, -0.3418836993f, 0, 0.3202971715f, 0.2834415347f, 0.9039195862f, 0, 0.8683227101f, -0.0003762656404f, -0.4959995258f, 0, 0.791120031f, -0.08511045745f, 0.6057105799f, 0,
+    -0.04011016052f, -0.4397248749f, 0.8972364289f, 0, 0.9145119872f, 0.3579346169f, -0.1885487608f, 0, -0.9612039066f, -0.2756484276f, 0.01024666929f, 0, 0.6510361721f, -0.2877799159f, -0.7023778346f, 0, -0.2041786351f, 0.7365237271f, 0.644859585f, 0, -0.7718263711f, 0.3790626912f, 0.5104855816f, 0, -0.3060082741f, -0.7692987727f, 0.5608371729f, 0, 0.454007341f, -0.5024843065f, 0.7357899537f, 0,
+    0.4816795475f, 0.6021208291f, -0.6367380315f, 0, 0.6961980369f, -0.3222197429f, 0.641469197f, 0, -0.6532160499f, -0.6781148932f, 0.3368515753f, 0, 0.5089301236f, -0.6154662304f, -0.6018234363f, 0, -0.1635919754f, -0.9133604627f, -0.372840892f, 0, 0.52408019f, -0.8437664109f, 0.1157505864f, 0, 0.5902587356f, 0.4983817807f, -0.6349883666f, 0, 0.5863227872f, 0.494764745f, 0.6414307729f, 0,
+    0.6779335087f, 0.2341345225f, 0.6968408593f, 0, 0.7177054546f, -0.6858979348f, 0.120178631f, 0, -0.5328819713f, -0.5205125012f, 0.6671608058f, 0, -0.8654874251f, -0.0700727088f, -0.4960053754f, 0, -0.2861810166f, 0.7952089234f, 0.5345495242f, 0, -0.04849529634f, 0.9810836427f, -0.1874115585f, 0, -0.6358521667f, 0.6058348682f, 0.4781800233f, 0, 0.6254794696f, -0.2861619734f, 0.7258696564f, 0,
+    -0.2585259868f, 0.5061949264f, -0.8227581726f, 0, 0.02136306781f, 0.5064016808f, -0.8620330371f, 0, 0.200111773f, 0.8599263484f, 0.4695550591f, 0, 0.4743561372f, 0.6014985084f, -0.6427953014f, 0, 0.6622993731f, -0.5202474575f, -0.5391679918f, 0, 0.08084972818f, -0.6532720452f, 0.7527940996f, 0, -0.6893687501f, 0.0592860349f, 0.7219805347f, 0, -0.1121887082f, -0.9673185067f, 0.2273952515f, 0,
+    0.7344116094f, 0.5979668656f, -0.3210532909f, 0, 0.5789393465f, -0.2488849713f, 0.7764570201f, 0, 0.6988182827f, 0.3557169806f, -0.6205791146f, 0, -0.8636845529f, -0.2748771249f, -0.4224826141f, 0, -0.4247027957f, -0.4640880967f, 0.777335046f, 0, 0.5257722489f, -0.8427017621f, 0.1158329937f, 0, 0.9343830603f, 0.316302472f, -0.1639543925f, 0, -0.1016836419f, -0.8057303073f, -0.5834887393f, 0,
+    -0.6529238969f, 0.50602126f, -0.5635892736f, 0, -0.2465286165f, -0.9668205684f, -0.06694497494f, 0, -0.9776897119f, -0.2099250524f, -0.007368825344f, 0, 0.7736893337f, 0.5734244712f, 0.2694238123f, 0, -0.6095087895f, 0.4995678998f, 0.6155736747f, 0, 0.5794535482f, 0.7434546771f, 0.3339292269f, 0, -0.8226211154f, 0.08142581855f, 0.5627293636f, 0, -0.510385483f, 0.4703667658f, 0.7199039967f, 0,
+    -0.5764971849f, -0.07231656274f, -0.8138926898f, 0, 0.7250628871f, 0.3949971505f, -0.5641463116f, 0, -0.1525424005f, 0.4860840828f, -0.8604958341f, 0, -0.5550976208f, -0.4957820792f, 0.667882296f, 0, -0.1883614327f, 0.9145869398f, 0.357841725f, 0, 0.7625556724f, -0.5414408243f, -0.3540489801f, 0, -0.5870231946f, -0.3226498013f, -0.7424963803f, 0, 0.3051124198f, 0.2262544068f, -0.9250488391f, 0,
+    0.6379576059f, 0.577242424f, -0.5097070502f, 0, -0.5966775796f, 0.1454852398f, -0.7891830656f, 0, -0.658330573f, 0.6555487542f, -0.3699414651f, 0, 0.7434892426f, 0.2351084581f, 0.6260573129f, 0, 0.5562114096f, 0.8264360377f, -0.0873632843f, 0, -0.3028940016f, -0.8251527185f, 0.4768419182f, 0, 0.1129343818f, -0.985888439f, -0.1235710781f, 0, 0.5937652891f, -0.5896813806f, 0.5474656618f, 0,
+    0.6757964092f, -0.5835758614f, -0.4502648413f, 0, 0.7242302609f, -0.1152719764f, 0.6798550586f, 0, -0.9511914166f, 0.0753623979f, -0.2992580792f, 0, 0.2539470961f, -0.1886339355f, 0.9486454084f, 0, 0.571433621f, -0.1679450851f, -0.8032795685f, 0, -0.06778234979f, 0.3978269256f, 0.9149531629f, 0, 0.6074972649f, 0.733060024f, -0.3058922593f, 0, -0.5435478392f, 0.1675822484f, 0.8224791405f, 0,
+    -0.5876678086f, -0.3380045064f, -0.7351186982f, 0, -0.7967562402f, 0.04097822706f, -0.6029098428f, 0, -0.1996350917f, 0.8706294745f, 0.4496111079f, 0, -0.02787660336f, -0.9106232682f, -0.4122962022f, 0, -0.7797625996f, -0.6257634692f, 0.01975775581f, 0, -0.5211232846f, 0.7401644346f, -0.4249554471f, 0, 0.8575424857f, 0.4053272873f, -0.3167501783f, 0, 0.1045223322f, 0.8390195772f, -0.5339674439f, 0,
+    0.3501822831f, 0.9242524096f, -0.1520850155f, 0, 0.1987849858f, 0.07647613266f, 0.9770547224f, 0, 0.7845996363f, 0.6066256811f, -0.1280964233f, 0, 0.09006737436f, -0.9750989929f, -0.2026569073f, 0, -0.8274343547f, -0.542299559f, 0.1458203587f, 0, -0.3485797732f, -0.415802277f, 0.840000362f, 0, -0.2471778936f, -0.7304819962f, -0.6366310879f, 0, -0.3700154943f, 0.8577948156f, 0.3567584454f, 0,
+    0.5913394901f, -0.548311967f, -0.5913303597f, 0, 0.1204873514f, -0.7626472379f, -0.6354935001f, 0, 0.616959265f, 0.03079647928f, 0.7863922953f, 0, 0.1258156836f, -0.6640829889f, -0.7369967419f, 0, -0.6477565124f, -0.1740147258f, -0.7417077429f, 0, 0.6217889313f, -0.7804430448f, -0.06547655076f, 0, 0.6589943422f, -0.6096987708f, 0.4404473475f, 0, -0.2689837504f, -0.6732403169f, -0.6887635427f, 0,
+    -0.3849775103f, 0.5676542638f, 0.7277093879f, 0, 0.5754444408f, 0.8110471154f, -0.1051963504f, 0, 0.9141593684f, 0.3832947817f, 0.131900567f, 0, -0.107925319f, 0.9245493968f, 0.3654593525f, 0, 0.377977089f, 0.3043148782f, 0.8743716458f, 0, -0.2142885215f, -0.8259286236f, 0.5214617324f, 0, 0.5802544474f, 0.4148098596f, -0.7008834116f, 0, -0.1982660881f, 0.8567161266f, -0.4761596756f, 0,
+    -0.03381553704f, 0.3773180787f, -0.9254661404f, 0, -0.6867922841f, -0.6656597827f, 0.2919133642f, 0, 0.7731742607f, -0.2875793547f, -0.5652430251f, 0, -0.09655941928f, 0.9193708367f, -0.3813575004f, 0, 0.2715702457f, -0.9577909544f, -0.09426605581f, 0, 0.2451015704f, -0.6917998565f, -0.6792188003f, 0, 0.977700782f, -0.1753855374f, 0.1155036542f, 0, -0.5224739938f, 0.8521606816f, 0.02903615945f, 0,
+    -0.7734880599f, -0.5261292347f, 0.3534179531f, 0, -0.7134492443f, -0.269547243f, 0.6467878011f, 0, 0.1644037271f, 0.5105846203f, -0.8439637196f, 0, 0.6494635788f, 0.05585611296f, 0.7583384168f, 0, -0.4711970882f, 0.5017280509f, -0.7254255765f, 0, -0.6335764307f, -0.2381686273f, -0.7361091029f, 0, -0.9021533097f, -0.270947803f, -0.3357181763f, 0, -0.3793711033f, 0.872258117f, 0.3086152025f, 0,
+    -0.6855598966f, -0.3250143309f, 0.6514394162f, 0, 0.2900942212f, -0.7799057743f, -0.5546100667f, 0, -0.2098319339f, 0.85037073f, 0.4825351604f, 0, -0.4592603758f, 0.6598504336f, -0.5947077538f, 0, 0.8715945488f, 0.09616365406f, -0.4807031248f, 0, -0.6776666319f, 0.7118504878f, -0.1844907016f, 0, 0.7044377633f, 0.312427597f, 0.637304036f, 0, -0.7052318886f, -0.2401093292f, -0.6670798253f, 0,
+    0.081921007f, -0.7207336136f, -0.6883545647f, 0, -0.6993680906f, -0.5875763221f, -0.4069869034f, 0, -0.1281454481f, 0.6419895885f, 0.7559286424f, 0, -0.6337388239f, -0.6785471501f, -0.3714146849f, 0, 0.5565051903f, -0.2168887573f, -0.8020356851f, 0, -0.5791554484f, 0.7244372011f, -0.3738578718f, 0, 0.1175779076f, -0.7096451073f, 0.6946792478f, 0, -0.6134619607f, 0.1323631078f, 0.7785527795f, 0,
+    0.6984635305f, -0.02980516237f, -0.715024719f, 0, 0.8318082963f, -0.3930171956f, 0.3919597455f, 0, 0.1469576422f, 0.05541651717f, -0.9875892167f, 0, 0.708868575f, -0.2690503865f, 0.6520101478f, 0, 0.2726053183f, 0.67369766f, -0.68688995f, 0, -0.6591295371f, 0.3035458599f, -0.6880466294f, 0, 0.4815131379f, -0.7528270071f, 0.4487723203f, 0, 0.9430009463f, 0.1675647412f, -0.2875261255f, 0,
+    0.434802957f, 0.7695304522f, -0.4677277752f, 0, 0.3931996188f, 0.594473625f, 0.7014236729f, 0, 0.7254336655f, -0.603925654f, 0.3301814672f, 0, 0.7590235227f, -0.6506083235f, 0.02433313207f, 0, -0.8552768592f, -0.3430042733f, 0.3883935666f, 0, -0.6139746835f, 0.6981725247f, 0.3682257648f, 0, -0.7465905486f, -0.5752009504f, 0.3342849376f, 0, 0.5730065677f, 0.810555537f, -0.1210916791f, 0,
+    -0.9225877367f, -0.3475211012f, -0.167514036f, 0, -0.7105816789f, -0.4719692027f, -0.5218416899f, 0, -0.08564609717f, 0.3583001386f, 0.929669703f, 0, -0.8279697606f, -0.2043157126f, 0.5222271202f, 0, 0.427944023f, 0.278165994f, 0.8599346446f, 0, 0.5399079671f, -0.7857120652f, -0.3019204161f, 0, 0.5678404253f, -0.5495413974f, -0.6128307303f, 0, -0.9896071041f, 0.1365639107f, -0.04503418428f, 0,
+    -0.6154342638f, -0.6440875597f, 0.4543037336f, 0, 0.1074204368f, -0.7946340692f, 0.5975094525f, 0, -0.3595449969f, -0.8885529948f, 0.28495784f, 0, -0.2180405296f, 0.1529888965f, 0.9638738118f, 0, -0.7277432317f, -0.6164050508f, -0.3007234646f, 0, 0.7249729114f, -0.00669719484f, 0.6887448187f, 0, -0.5553659455f, -0.5336586252f, 0.6377908264f, 0, 0.5137558015f, 0.7976208196f, -0.3160000073f, 0,
+    -0.3794024848f, 0.9245608561f, -0.03522751494f, 0, 0.8229248658f, 0.2745365933f, -0.4974176556f, 0, -0.5404114394f, 0.6091141441f, 0.5804613989f, 0, 0.8036581901f, -0.2703029469f, 0.5301601931f, 0, 0.6044318879f, 0.6832968393f, 0.4095943388f, 0, 0.06389988817f, 0.9658208605f, -0.2512108074f, 0, 0.1087113286f, 0.7402471173f, -0.6634877936f, 0, -0.713427712f, -0.6926784018f, 0.1059128479f, 0,
+    0.6458897819f, -0.5724548511f, -0.5050958653f, 0, -0.6553931414f, 0.7381471625f, 0.159995615f, 0, 0.3910961323f, 0.9188871375f, -0.05186755998f, 0, -0.4879022471f, -0.5904376907f, 0.6429111375f, 0, 0.6014790094f, 0.7707441366f, -0.2101820095f, 0, -0.5677173047f, 0.7511360995f, 0.3368851762f, 0, 0.7858573506f, 0.226674665f, 0.5753666838f, 0, -0.4520345543f, -0.604222686f, -0.6561857263f, 0,
+    0.002272116345f, 0.4132844051f, -0.9105991643f, 0, -0.5815751419f, -0.5162925989f, 0.6286591339f, 0, -0.03703704785f, 0.8273785755f, 0.5604221175f, 0, -0.5119692504f, 0.7953543429f, -0.3244980058f, 0, -0.2682417366f, -0.9572290247f, -0.1084387619f, 0, -0.2322482736f, -0.9679131102f, -0.09594243324f, 0, 0.3554328906f, -0.8881505545f, 0.2913006227f, 0, 0.7346520519f, -0.4371373164f, 0.5188422971f, 0,
+    0.9985120116f, 0.04659011161f, -0.02833944577f, 0, -0.3727687496f, -0.9082481361f, 0.1900757285f, 0, 0.91737377f, -0.3483642108f, 0.1925298489f, 0, 0.2714911074f, 0.4147529736f, -0.8684886582f, 0, 0.5131763485f, -0.7116334161f, 0.4798207128f, 0, -0.8737353606f, 0.18886992f, -0.4482350644f, 0, 0.8460043821f, -0.3725217914f, 0.3814499973f, 0, 0.8978727456f, -0.1780209141f, -0.4026575304f, 0,
+    0.2178065647f, -0.9698322841f, -0.1094789531f, 0, -0.1518031304f, -0.7788918132f, -0.6085091231f, 0, -0.2600384876f, -0.4755398075f, -0.8403819825f, 0, 0.572313509f, -0.7474340931f, -0.3373418503f, 0, -0.7174141009f, 0.1699017182f, -0.6756111411f, 0, -0.684180784f, 0.02145707593f, -0.7289967412f, 0, -0.2007447902f, 0.06555605789f, -0.9774476623f, 0, -0.1148803697f, -0.8044887315f, 0.5827524187f, 0,
+    -0.7870349638f, 0.03447489231f, 0.6159443543f, 0, -0.2015596421f, 0.6859872284f, 0.6991389226f, 0, -0.08581082512f, -0.10920836f, -0.9903080513f, 0, 0.5532693395f, 0.7325250401f, -0.396610771f, 0, -0.1842489331f, -0.9777375055f, -0.1004076743f, 0, 0.0775473789f, -0.9111505856f, 0.4047110257f, 0, 0.1399838409f, 0.7601631212f, -0.6344734459f, 0, 0.4484419361f, -0.845289248f, 0.2904925424f, 0
+};
+
+/// <summary>
+/// Compile-time settings for FastNoiseStatic, defaults match a default FastNoiseLite.
+/// Derive and shadow the members that differ:
+/// <code>struct Clouds : FastNoiseSettings { static constexpr float frequency = 0.02f; };</code>
+/// </summary>
+struct FastNoiseSettings
+{
+    static constexpr int seed = 1337;
+    static constexpr float frequency = 0.01f;
+    static constexpr FastNoiseLite::NoiseType noiseType = FastNoiseLite::NoiseType_OpenSimplex2;
+    static constexpr FastNoiseLite::RotationType3D rotationType3D = FastNoiseLite::RotationType3D_None;
+
+    static constexpr FastNoiseLite::FractalType fractalType = FastNoiseLite::FractalType_None;
+    static constexpr int fractalOctaves = 3;
+    static constexpr float fractalLacunarity = 2.0f;
+    static constexpr float fractalGain = 0.5f;
+    static constexpr float fractalWeightedStrength = 0.0f;
+    static constexpr float fractalPingPongStrength = 2.0f;
+
+    static constexpr FastNoiseLite::CellularDistanceFunction cellularDistanceFunction = FastNoiseLite::CellularDistanceFunction_EuclideanSq;
+    static constexpr FastNoiseLite::CellularReturnType cellularReturnType = FastNoiseLite::CellularReturnType_Distance;
+    static constexpr float cellularJitter = 1.0f;
+};
+
+/// <summary>
+/// FastNoiseLite with every setting fixed at compile time. GetNoise resolves the noise type,
+/// fractal type and coordinate transform with if constexpr, so the exact kernel can be inlined
+/// into the caller with no runtime dispatch. Output is identical to a FastNoiseLite configured
+/// with the same settings, which stays available for runtime-configured noise.
+/// Immutable after construction, one instance can be shared by any number of threads.
+/// </summary>
+template <typename Settings>
+class FastNoiseStatic
+{
+    typedef FastNoiseLite FNL;
+
+public:
+    FastNoiseStatic()
+        : mBase(MakeBase())
+    {
+    }
+
+    /// <summary>
+    /// 2D noise at given position
+    /// </summary>
+    /// <returns>
+    /// Noise output bounded between -1...1
+    /// </returns>
+    template <typename FNfloat>
+    float GetNoise(FNfloat x, FNfloat y) const
+    {
+        FNL::Arguments_must_be_floating_point_values<FNfloat>();
+
+        TransformNoiseCoordinate(x, y);
+
+        if constexpr (Settings::fractalType == FNL::FractalType_FBm)
+            return GenFractalFBm(x, y);
+        else if constexpr (Settings::fractalType == FNL::FractalType_Ridged)
+            return GenFractalRidged(x, y);
+        else if constexpr (Settings::fractalType == FNL::FractalType_PingPong)
+            return GenFractalPingPong(x, y);
+        else
+            return GenNoiseSingle(Settings::seed, x, y);
+    }
+
+    /// <summary>
+    /// 3D noise at given position
+    /// </summary>
+    /// <returns>
+    /// Noise output bounded between -1...1
+    /// </returns>
+    template <typename FNfloat>
+    float GetNoise(FNfloat x, FNfloat y, FNfloat z) const
+    {
+        FNL::Arguments_must_be_floating_point_values<FNfloat>();
+
+        TransformNoiseCoordinate(x, y, z);
+
+        if constexpr (Settings::fractalType == FNL::FractalType_FBm)
+            return GenFractalFBm(x, y, z);
+        else if constexpr (Settings::fractalType == FNL::FractalType_Ridged)
+            return GenFractalRidged(x, y, z);
+        else if constexpr (Settings::fractalType == FNL::FractalType_PingPong)
+            return GenFractalPingPong(x, y, z);
+        else
+            return GenNoiseSingle(Settings::seed, x, y, z);
+    }
+
+    /// <summary>
+    /// 2D noise at n positions, see FastNoiseLite::GetNoiseBatch.
+    /// The SIMD kernel, fractal type and octave constants are fixed at compile time.
+    /// </summary>
+    void GetNoiseBatch(const float* xs, const float* ys, float* out, size_t n) const
+    {
+#if defined(FNL_SIMD)
+        if constexpr (Settings::noiseType == FNL::NoiseType_OpenSimplex2)
+        {
+            SimdFractalBatch(xs, ys, out, n,
+                [](int seed, SimdFloat x, SimdFloat y) { return FNL::SimdSingleSimplex(seed, x, y); });
+            return;
+        }
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Cellular)
+        {
+            SimdFractalBatch(xs, ys, out, n,
+                [](int seed, SimdFloat x, SimdFloat y) { return FNL::SimdSingleCellularFast<Settings::cellularDistanceFunction, Settings::cellularReturnType>(seed, x, y, CellularTable); });
+            return;
+        }
+#endif
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = GetNoise(xs[i], ys[i]);
+        }
+    }
+
+    /// <summary>
+    /// 3D noise at n positions, see FastNoiseLite::GetNoiseBatch.
+    /// The SIMD kernel, fractal type and octave constants are fixed at compile time.
+    /// </summary>
+    void GetNoiseBatch(const float* xs, const float* ys, const float* zs, float* out, size_t n) const
+    {
+#if defined(FNL_SIMD)
+        if constexpr (Settings::noiseType == FNL::NoiseType_OpenSimplex2)
+        {
+            SimdFractalBatch(xs, ys, zs, out, n,
+                [](int seed, SimdFloat x, SimdFloat y, SimdFloat z) { return FNL::SimdSingleOpenSimplex2(seed, x, y, z); });
+            return;
+        }
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Cellular)
+        {
+            SimdFractalBatch(xs, ys, zs, out, n,
+                [](int seed, SimdFloat x, SimdFloat y, SimdFloat z) { return FNL::SimdSingleCellularFast<Settings::cellularDistanceFunction, Settings::cellularReturnType>(seed, x, y, z, CellularTable); });
+            return;
+        }
+#endif
+        for (size_t i = 0; i < n; i++)
+        {
+            out[i] = GetNoise(xs[i], ys[i], zs[i]);
+        }
+    }
+
+private:
+    // Kernels are shared with FastNoiseLite; mBase holds the same settings for the few
+    // that read them at runtime (cellular jitter, distance function and return type)
+    const FNL mBase;
+
+    static FNL MakeBase()
+    {
+        FNL base(Settings::seed);
+        base.SetFrequency(Settings::frequency);
+        base.SetNoiseType(Settings::noiseType);
+        base.SetRotationType3D(Settings::rotationType3D);
+        base.SetFractalType(Settings::fractalType);
+        base.SetFractalOctaves(Settings::fractalOctaves);
+        base.SetFractalLacunarity(Settings::fractalLacunarity);
+        base.SetFractalGain(Settings::fractalGain);
+        base.SetFractalWeightedStrength(Settings::fractalWeightedStrength);
+        base.SetFractalPingPongStrength(Settings::fractalPingPongStrength);
+        base.SetCellularDistanceFunction(Settings::cellularDistanceFunction);
+        base.SetCellularReturnType(Settings::cellularReturnType);
+        base.SetCellularJitter(Settings::cellularJitter);
+        return base;
+    }
+
+#if defined(FNL_SIMD)
+    // Jittered feature point offsets for the batch cellular kernel, built once per Settings on first use
+    static inline const FNL::SimdCellularTable CellularTable { Settings::cellularJitter };
+#endif
+
+    static constexpr bool IsOpenSimplex2 = Settings::noiseType == FNL::NoiseType_OpenSimplex2 || Settings::noiseType == FNL::NoiseType_OpenSimplex2S;
+
+    static constexpr FNL::TransformType3D TransformType3D =
+        Settings::rotationType3D == FNL::RotationType3D_ImproveXYPlanes ? FNL::TransformType3D_ImproveXYPlanes :
+        Settings::rotationType3D == FNL::RotationType3D_ImproveXZPlanes ? FNL::TransformType3D_ImproveXZPlanes :
+        IsOpenSimplex2 ? FNL::TransformType3D_DefaultOpenSimplex2 : FNL::TransformType3D_None;
+
+    static constexpr float CalculateFractalBounding()
+    {
+        float gain = Settings::fractalGain < 0 ? -Settings::fractalGain : Settings::fractalGain;
+        float amp = gain;
+        float ampFractal = 1.0f;
+        for (int i = 1; i < Settings::fractalOctaves; i++)
+        {
+            ampFractal += amp;
+            amp *= gain;
+        }
+        return 1 / ampFractal;
+    }
+
+    static constexpr float FractalBounding = CalculateFractalBounding();
+
+    // Lerp(1, t, weightedStrength), skipped entirely when the strength is zero
+    static float Weighted(float t)
+    {
+        if constexpr (Settings::fractalWeightedStrength == 0.0f)
+            return 1.0f;
+        else
+            return FNL::Lerp(1.0f, t, Settings::fractalWeightedStrength);
+    }
+
+    template <typename FNfloat>
+    float GenNoiseSingle(int seed, FNfloat x, FNfloat y) const
+    {
+        if constexpr (Settings::noiseType == FNL::NoiseType_OpenSimplex2)
+            return mBase.SingleSimplex(seed, x, y);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_OpenSimplex2S)
+            return mBase.SingleOpenSimplex2S(seed, x, y);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Cellular)
+            return mBase.SingleCellular(seed, x, y);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Perlin)
+            return mBase.SinglePerlin(seed, x, y);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_ValueCubic)
+            return mBase.SingleValueCubic(seed, x, y);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Value)
+            return mBase.SingleValue(seed, x, y);
+        else
+            return 0;
+    }
+
+    template <typename FNfloat>
+    float GenNoiseSingle(int seed, FNfloat x, FNfloat y, FNfloat z) const
+    {
+        if constexpr (Settings::noiseType == FNL::NoiseType_OpenSimplex2)
+            return mBase.SingleOpenSimplex2(seed, x, y, z);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_OpenSimplex2S)
+            return mBase.SingleOpenSimplex2S(seed, x, y, z);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Cellular)
+            return mBase.SingleCellular(seed, x, y, z);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Perlin)
+            return mBase.SinglePerlin(seed, x, y, z);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_ValueCubic)
+            return mBase.SingleValueCubic(seed, x, y, z);
+        else if constexpr (Settings::noiseType == FNL::NoiseType_Value)
+            return mBase.SingleValue(seed, x, y, z);
+        else
+            return 0;
+    }
+
+    template <typename FNfloat>
+    static void TransformNoiseCoordinate(FNfloat& x, FNfloat& y)
+    {
+        x *= Settings::frequency;
+        y *= Settings::frequency;
+
+        if constexpr (IsOpenSimplex2)
+        {
+            const FNfloat SQRT3 = (FNfloat)1.7320508075688772935274463415059;
+            const FNfloat F2 = 0.5f * (SQRT3 - 1);
+            FNfloat t = (x + y) * F2;
+            x += t;
+            y += t;
+        }
+    }
+
+    template <typename FNfloat>
+    static void TransformNoiseCoordinate(FNfloat& x, FNfloat& y, FNfloat& z)
+    {
+        x *= Settings::frequency;
+        y *= Settings::frequency;
+        z *= Settings::frequency;
+
+        if constexpr (TransformType3D == FNL::TransformType3D_ImproveXYPlanes)
+        {
+            FNfloat xy = x + y;
+            FNfloat s2 = xy * -(FNfloat)0.211324865405187;
+            z *= (FNfloat)0.577350269189626;
+            x += s2 - z;
+            y = y + s2 - z;
+            z += xy * (FNfloat)0.577350269189626;
+        }
+        else if constexpr (TransformType3D == FNL::TransformType3D_ImproveXZPlanes)
+        {
+            FNfloat xz = x + z;
+            FNfloat s2 = xz * -(FNfloat)0.211324865405187;
+            y *= (FNfloat)0.577350269189626;
+            x += s2 - y;
+            z += s2 - y;
+            y += xz * (FNfloat)0.577350269189626;
+        }
+        else if constexpr (TransformType3D == FNL::TransformType3D_DefaultOpenSimplex2)
+        {
+            const FNfloat R3 = (FNfloat)(2.0 / 3.0);
+            FNfloat r = (x + y + z) * R3; // Rotation, not skew
+            x = r - x;
+            y = r - y;
+            z = r - z;
+        }
+    }
+
+    template <typename FNfloat>
+    float GenFractalFBm(FNfloat x, FNfloat y) const
+    {
+        int seed = Settings::seed;
+        float sum = 0;
+        float amp = FractalBounding;
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            float noise = GenNoiseSingle(seed++, x, y);
+            sum += noise * amp;
+            amp *= Weighted(FNL::FastMin(noise + 1, 2) * 0.5f);
+
+            x *= Settings::fractalLacunarity;
+            y *= Settings::fractalLacunarity;
+            amp *= Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename FNfloat>
+    float GenFractalFBm(FNfloat x, FNfloat y, FNfloat z) const
+    {
+        int seed = Settings::seed;
+        float sum = 0;
+        float amp = FractalBounding;
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            float noise = GenNoiseSingle(seed++, x, y, z);
+            sum += noise * amp;
+            amp *= Weighted((noise + 1) * 0.5f);
+
+            x *= Settings::fractalLacunarity;
+            y *= Settings::fractalLacunarity;
+            z *= Settings::fractalLacunarity;
+            amp *= Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename FNfloat>
+    float GenFractalRidged(FNfloat x, FNfloat y) const
+    {
+        int seed = Settings::seed;
+        float sum = 0;
+        float amp = FractalBounding;
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            float noise = FNL::FastAbs(GenNoiseSingle(seed++, x, y));
+            sum += (noise * -2 + 1) * amp;
+            amp *= Weighted(1 - noise);
+
+            x *= Settings::fractalLacunarity;
+            y *= Settings::fractalLacunarity;
+            amp *= Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename FNfloat>
+    float GenFractalRidged(FNfloat x, FNfloat y, FNfloat z) const
+    {
+        int seed = Settings::seed;
+        float sum = 0;
+        float amp = FractalBounding;
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            float noise = FNL::FastAbs(GenNoiseSingle(seed++, x, y, z));
+            sum += (noise * -2 + 1) * amp;
+            amp *= Weighted(1 - noise);
+
+            x *= Settings::fractalLacunarity;
+            y *= Settings::fractalLacunarity;
+            z *= Settings::fractalLacunarity;
+            amp *= Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename FNfloat>
+    float GenFractalPingPong(FNfloat x, FNfloat y) const
+    {
+        int seed = Settings::seed;
+        float sum = 0;
+        float amp = FractalBounding;
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            float noise = FNL::PingPong((GenNoiseSingle(seed++, x, y) + 1) * Settings::fractalPingPongStrength);
+            sum += (noise - 0.5f) * 2 * amp;
+            amp *= Weighted(noise);
+
+            x *= Settings::fractalLacunarity;
+            y *= Settings::fractalLacunarity;
+            amp *= Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename FNfloat>
+    float GenFractalPingPong(FNfloat x, FNfloat y, FNfloat z) const
+    {
+        int seed = Settings::seed;
+        float sum = 0;
+        float amp = FractalBounding;
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            float noise = FNL::PingPong((GenNoiseSingle(seed++, x, y, z) + 1) * Settings::fractalPingPongStrength);
+            sum += (noise - 0.5f) * 2 * amp;
+            amp *= Weighted(noise);
+
+            x *= Settings::fractalLacunarity;
+            y *= Settings::fractalLacunarity;
+            z *= Settings::fractalLacunarity;
+            amp *= Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+#if defined(FNL_SIMD)
+    typedef FNL::SimdFloat SimdFloat;
+
+    // SIMD Lerp(1, t, weightedStrength), skipped entirely when the strength is zero
+    static SimdFloat SimdWeighted(SimdFloat t)
+    {
+        if constexpr (Settings::fractalWeightedStrength == 0.0f)
+            return FNLSimd::Set(1);
+        else
+            return FNL::SimdLerp(1.0f, t, Settings::fractalWeightedStrength);
+    }
+
+    // Batch drivers: same loops as FastNoiseLite's, with the transform and fractal type
+    // resolved by if constexpr instead of switching on runtime members
+
+    template <typename Kernel>
+    static void SimdFractalBatch(const float* xs, const float* ys, float* out, size_t n, const Kernel& kernel)
+    {
+        FNL::SimdBatchLoop(xs, ys, out, n, [&](SimdFloat x, SimdFloat y)
+        {
+            x = x * Settings::frequency;
+            y = y * Settings::frequency;
+
+            if constexpr (IsOpenSimplex2)
+            {
+                const float SQRT3 = 1.7320508075688772935274463415059f;
+                const float F2 = 0.5f * (SQRT3 - 1);
+                SimdFloat t = (x + y) * F2;
+                x = x + t;
+                y = y + t;
+            }
+
+            if constexpr (Settings::fractalType == FNL::FractalType_FBm)
+                return SimdFractalFBm(kernel, x, y);
+            else if constexpr (Settings::fractalType == FNL::FractalType_Ridged)
+                return SimdFractalRidged(kernel, x, y);
+            else if constexpr (Settings::fractalType == FNL::FractalType_PingPong)
+                return SimdFractalPingPong(kernel, x, y);
+            else
+                return kernel(Settings::seed, x, y);
+        });
+    }
+
+    template <typename Kernel>
+    static void SimdFractalBatch(const float* xs, const float* ys, const float* zs, float* out, size_t n, const Kernel& kernel)
+    {
+        FNL::SimdBatchLoop(xs, ys, zs, out, n, [&](SimdFloat x, SimdFloat y, SimdFloat z)
+        {
+            SimdTransformNoiseCoordinate(x, y, z);
+
+            if constexpr (Settings::fractalType == FNL::FractalType_FBm)
+                return SimdFractalFBm(kernel, x, y, z);
+            else if constexpr (Settings::fractalType == FNL::FractalType_Ridged)
+                return SimdFractalRidged(kernel, x, y, z);
+            else if constexpr (Settings::fractalType == FNL::FractalType_PingPong)
+                return SimdFractalPingPong(kernel, x, y, z);
+            else
+                return kernel(Settings::seed, x, y, z);
+        });
+    }
+
+    static void SimdTransformNoiseCoordinate(SimdFloat& x, SimdFloat& y, SimdFloat& z)
+    {
+        x = x * Settings::frequency;
+        y = y * Settings::frequency;
+        z = z * Settings::frequency;
+
+        if constexpr (TransformType3D == FNL::TransformType3D_ImproveXYPlanes)
+        {
+            SimdFloat xy = x + y;
+            SimdFloat s2 = xy * -0.211324865405187f;
+            z = z * 0.577350269189626f;
+            x = x + (s2 - z);
+            y = y + s2 - z;
+            z = z + xy * 0.577350269189626f;
+        }
+        else if constexpr (TransformType3D == FNL::TransformType3D_ImproveXZPlanes)
+        {
+            SimdFloat xz = x + z;
+            SimdFloat s2 = xz * -0.211324865405187f;
+            y = y * 0.577350269189626f;
+            x = x + (s2 - y);
+            z = z + (s2 - y);
+            y = y + xz * 0.577350269189626f;
+        }
+        else if constexpr (TransformType3D == FNL::TransformType3D_DefaultOpenSimplex2)
+        {
+            const float R3 = (float)(2.0 / 3.0);
+            SimdFloat r = (x + y + z) * R3; // Rotation, not skew
+            x = r - x;
+            y = r - y;
+            z = r - z;
+        }
+    }
+
+    template <typename Kernel>
+    static SimdFloat SimdFractalFBm(const Kernel& kernel, SimdFloat x, SimdFloat y)
+    {
+        int seed = Settings::seed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(FractalBounding);
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            SimdFloat noise = kernel(seed++, x, y);
+            sum = sum + noise * amp;
+            amp = amp * SimdWeighted(FNLSimd::Min(noise + 1.0f, FNLSimd::Set(2)) * 0.5f);
+
+            x = x * Settings::fractalLacunarity;
+            y = y * Settings::fractalLacunarity;
+            amp = amp * Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    static SimdFloat SimdFractalFBm(const Kernel& kernel, SimdFloat x, SimdFloat y, SimdFloat z)
+    {
+        int seed = Settings::seed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(FractalBounding);
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            SimdFloat noise = kernel(seed++, x, y, z);
+            sum = sum + noise * amp;
+            amp = amp * SimdWeighted((noise + 1.0f) * 0.5f);
+
+            x = x * Settings::fractalLacunarity;
+            y = y * Settings::fractalLacunarity;
+            z = z * Settings::fractalLacunarity;
+            amp = amp * Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    static SimdFloat SimdFractalRidged(const Kernel& kernel, SimdFloat x, SimdFloat y)
+    {
+        int seed = Settings::seed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(FractalBounding);
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            SimdFloat noise = FNLSimd::Abs(kernel(seed++, x, y));
+            sum = sum + (noise * -2.0f + 1.0f) * amp;
+            amp = amp * SimdWeighted(1.0f - noise);
+
+            x = x * Settings::fractalLacunarity;
+            y = y * Settings::fractalLacunarity;
+            amp = amp * Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    static SimdFloat SimdFractalRidged(const Kernel& kernel, SimdFloat x, SimdFloat y, SimdFloat z)
+    {
+        int seed = Settings::seed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(FractalBounding);
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            SimdFloat noise = FNLSimd::Abs(kernel(seed++, x, y, z));
+            sum = sum + (noise * -2.0f + 1.0f) * amp;
+            amp = amp * SimdWeighted(1.0f - noise);
+
+            x = x * Settings::fractalLacunarity;
+            y = y * Settings::fractalLacunarity;
+            z = z * Settings::fractalLacunarity;
+            amp = amp * Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    static SimdFloat SimdFractalPingPong(const Kernel& kernel, SimdFloat x, SimdFloat y)
+    {
+        int seed = Settings::seed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(FractalBounding);
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            SimdFloat noise = FNL::SimdPingPong((kernel(seed++, x, y) + 1.0f) * Settings::fractalPingPongStrength);
+            sum = sum + (noise - 0.5f) * 2.0f * amp;
+            amp = amp * SimdWeighted(noise);
+
+            x = x * Settings::fractalLacunarity;
+            y = y * Settings::fractalLacunarity;
+            amp = amp * Settings::fractalGain;
+        }
+
+        return sum;
+    }
+
+    template <typename Kernel>
+    static SimdFloat SimdFractalPingPong(const Kernel& kernel, SimdFloat x, SimdFloat y, SimdFloat z)
+    {
+        int seed = Settings::seed;
+        SimdFloat sum = FNLSimd::Set(0);
+        SimdFloat amp = FNLSimd::Set(FractalBounding);
+
+        for (int i = 0; i < Settings::fractalOctaves; i++)
+        {
+            SimdFloat noise = FNL::SimdPingPong((kernel(seed++, x, y, z) + 1.0f) * Settings::fractalPingPongStrength);
+            sum = sum + (noise - 0.5f) * 2.0f * amp;
+            amp = amp * SimdWeighted(noise);
+
+            x = x * Settings::fractalLacunarity;
+            y = y * Settings::fractalLacunarity;
+            z = z * Settings::fractalLacunarity;
+            amp = amp * Settings::fractalGain;
+        }
+
+        return sum;
+    }
+#endif
 };
 
 #endif
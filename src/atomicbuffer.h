@@ -0,0 +1,70 @@
+// atomicbuffer.h
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include "color.h"
+#include "depth.h"
+#include "layout.h"
+
+// Profundidad y color de cada pixel en una sola palabra de 64 bits: la profundidad en los 32
+// bits altos y el RGBA en los bajos. El fragmento mas cercano es el de menor valor, asi que un
+// min atomico hace la prueba de profundidad y la escritura de una vez y cualquier hilo puede
+// escribir cualquier pixel sin locks ni tiles asignados. resolve() copia despues el color de
+// los pixeles cubiertos al framebuffer.
+template <int Width, int Height, typename Layout = BufferLayout>
+struct AtomicDepthColorBuffer {
+    // Pixel sin ningun fragmento: mas lejos que cualquier profundidad
+    static constexpr uint64_t EMPTY = ~uint64_t(0);
+
+    ScreenBuffer<std::atomic<uint64_t>, Width, Height, Layout> pixels;
+
+    // Clave de 32 bits que crece con la distancia a la camara para z de cualquier signo
+    static uint32_t depthKey(float z) {
+        uint32_t bits;
+        std::memcpy(&bits, &z, sizeof(bits));
+        bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        return DepthFormat::Reversed ? ~bits : bits;
+    }
+
+    // RGBA de 32 bits con r en el byte bajo
+    static uint32_t packColor(const Color& color) {
+        return uint32_t(color.r) | (uint32_t(color.g) << 8) | (uint32_t(color.b) << 16) | (uint32_t(color.a) << 24);
+    }
+
+    static Color unpackColor(uint32_t rgba) {
+        return Color(int(rgba & 0xff), int((rgba >> 8) & 0xff), int((rgba >> 16) & 0xff), int(rgba >> 24));
+    }
+
+    static uint64_t pack(float z, const Color& color) {
+        return (uint64_t(depthKey(z)) << 32) | packColor(color);
+    }
+
+    // Guarda el fragmento si esta mas cerca que lo que haya en el pixel
+    void write(int x, int y, float z, const Color& color) {
+        uint64_t value = pack(z, color);
+        std::atomic<uint64_t>& pixel = pixels(x, y);
+        uint64_t current = pixel.load(std::memory_order_relaxed);
+        while (value < current && !pixel.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Rango [begin, end) de posiciones en memoria, para repartir clear() y resolve() en tareas
+    static constexpr int size() { return int(Layout::size(Width, Height)); }
+
+    void clear(int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            pixels.data[i].store(EMPTY, std::memory_order_relaxed);
+        }
+    }
+
+    // Copia el color de los pixeles cubiertos a target, que debe tener el mismo layout
+    void resolve(ScreenBuffer<Color, Width, Height, Layout>& target, int begin, int end) const {
+        for (int i = begin; i < end; ++i) {
+            uint64_t value = pixels.data[i].load(std::memory_order_relaxed);
+            if (value != EMPTY) {
+                target.data[i] = unpackColor(uint32_t(value));
+            }
+        }
+    }
+};
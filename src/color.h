@@ -1,27 +1,28 @@
 #pragma once
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 
 struct Color {
-    int r;
-    int g;
-    int b;
-    int a;
+    std::uint8_t r;
+    std::uint8_t g;
+    std::uint8_t b;
+    std::uint8_t a;
 
     Color() : r(0), g(0), b(0), a(255) {}
 
     Color(int red, int green, int blue, int alpha = 255) {
-        r = static_cast<Uint8>(std::min(std::max(red, 0), 255));
-        g = static_cast<Uint8>(std::min(std::max(green, 0), 255));
-        b = static_cast<Uint8>(std::min(std::max(blue, 0), 255));
-        a = static_cast<Uint8>(std::min(std::max(alpha, 0), 255));
+        r = static_cast<std::uint8_t>(std::min(std::max(red, 0), 255));
+        g = static_cast<std::uint8_t>(std::min(std::max(green, 0), 255));
+        b = static_cast<std::uint8_t>(std::min(std::max(blue, 0), 255));
+        a = static_cast<std::uint8_t>(std::min(std::max(alpha, 0), 255));
     }
 
     Color(float red, float green, float blue, float alpha = 1.0f) {
-        r = std::clamp(static_cast<Uint8>(red * 255), Uint8(0), Uint8(255));
-        g = std::clamp(static_cast<Uint8>(green * 255), Uint8(0), Uint8(255));
-        b = std::clamp(static_cast<Uint8>(blue * 255), Uint8(0), Uint8(255));
-        a = std::clamp(static_cast<Uint8>(alpha * 255), Uint8(0), Uint8(255));
+        r = std::clamp(static_cast<std::uint8_t>(red * 255), std::uint8_t(0), std::uint8_t(255));
+        g = std::clamp(static_cast<std::uint8_t>(green * 255), std::uint8_t(0), std::uint8_t(255));
+        b = std::clamp(static_cast<std::uint8_t>(blue * 255), std::uint8_t(0), std::uint8_t(255));
+        a = std::clamp(static_cast<std::uint8_t>(alpha * 255), std::uint8_t(0), std::uint8_t(255));
     }
 
     // Overload the + operator to add colors
@@ -37,10 +38,10 @@ struct Color {
     // Overload the * operator to scale colors by a factor
     Color operator*(float factor) const {
         return Color(
-                std::clamp(static_cast<Uint8>(r * factor), Uint8(0), Uint8(255)),
-                std::clamp(static_cast<Uint8>(g * factor), Uint8(0), Uint8(255)),
-                std::clamp(static_cast<Uint8>(b * factor), Uint8(0), Uint8(255)),
-                std::clamp(static_cast<Uint8>(a * factor), Uint8(0), Uint8(255))
+                std::clamp(static_cast<std::uint8_t>(r * factor), std::uint8_t(0), std::uint8_t(255)),
+                std::clamp(static_cast<std::uint8_t>(g * factor), std::uint8_t(0), std::uint8_t(255)),
+                std::clamp(static_cast<std::uint8_t>(b * factor), std::uint8_t(0), std::uint8_t(255)),
+                std::clamp(static_cast<std::uint8_t>(a * factor), std::uint8_t(0), std::uint8_t(255))
         );
     }
 
@@ -0,0 +1,201 @@
+// depth.h
+#pragma once
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include "layout.h"
+
+// Formatos de profundidad. Cada uno define como se guarda z (ya en [0, 1] tras el viewport),
+// el valor "lejano" con el que empieza cada pixel y que valor esta mas cerca.
+
+// float de 32 bits, el formato original
+struct DepthFloat32 {
+    using Stored = float;
+    static constexpr bool Reversed = false;
+    static constexpr Stored Far = 99999.0f;
+
+    static Stored encode(float z) { return z; }
+    static bool closer(Stored a, Stored b) { return a < b; }
+};
+
+// float con z invertida (1 cerca, 0 lejos). La proyeccion ya entrega z invertida, asi la
+// precision extra del float cerca de 0 cae en las distancias lejanas
+struct DepthReversedFloat32 {
+    using Stored = float;
+    static constexpr bool Reversed = true;
+    static constexpr Stored Far = -99999.0f;
+
+    static Stored encode(float z) { return z; }
+    static bool closer(Stored a, Stored b) { return a > b; }
+};
+
+// unorm de 16 bits: la mitad de ancho de banda que float. A distancia 15 distingue ~0.03
+// unidades, de sobra entre la cara frontal y trasera de los planetas
+struct DepthUnorm16 {
+    using Stored = uint16_t;
+    static constexpr bool Reversed = false;
+    static constexpr Stored Far = 0xFFFF;
+
+    static Stored encode(float z) { return Stored(std::clamp(z, 0.0f, 1.0f) * 65535.0f + 0.5f); }
+    static bool closer(Stored a, Stored b) { return a < b; }
+};
+
+// unorm de 24 bits en una palabra de 32 (los 8 bits altos quedan libres, como en D24S8)
+struct DepthUnorm24 {
+    using Stored = uint32_t;
+    static constexpr bool Reversed = false;
+    static constexpr Stored Far = 0xFFFFFF;
+
+    static Stored encode(float z) { return Stored(std::clamp(z, 0.0f, 1.0f) * 16777215.0f + 0.5f); }
+    static bool closer(Stored a, Stored b) { return a < b; }
+};
+
+// Formato del z-buffer, se elige al compilar (GC_DEPTH_FORMAT en CMakeLists.txt)
+#ifndef GC_DEPTH_FORMAT
+#define GC_DEPTH_FORMAT DepthFloat32
+#endif
+using DepthFormat = GC_DEPTH_FORMAT;
+
+// Z-buffer dividido en tiles de 8x8 con una generacion por tile. clear() solo avanza la
+// generacion del frame; un tile con generacion vieja cuenta como lejano y se rellena con
+// Format::Far la primera vez que se escribe en el. Asi no hay pasada de limpieza completa y
+// los tiles que nadie toca (el cielo) nunca se escriben.
+// La profundidad se guarda en el mismo layout que el color (layout.h)
+template <int Width, int Height, typename Format = DepthFormat, typename Layout = BufferLayout>
+struct DepthBuffer {
+    using Stored = typename Format::Stored;
+
+    static constexpr int TILE = 8;
+    static constexpr int TILES_X = (Width + TILE - 1) / TILE;
+    static constexpr int TILES_Y = (Height + TILE - 1) / TILE;
+
+    ScreenBuffer<Stored, Width, Height, Layout> depth;
+    std::array<uint32_t, TILES_X * TILES_Y> tileGeneration{}; // 0: nunca usado
+    uint32_t generation = 1;
+
+    // Z jerarquico: profundidad mas lejana de cada tile. Una escritura solo marca el tile como
+    // sucio y el valor se recalcula cuando alguien lo consulta
+    std::array<Stored, TILES_X * TILES_Y> tileFarthest;
+    std::array<bool, TILES_X * TILES_Y> tileDirty{};
+
+    void clear() {
+        ++generation;
+        // Al dar la vuelta, una generacion vieja podria coincidir con la nueva
+        if (generation == 0) {
+            tileGeneration.fill(0);
+            generation = 1;
+        }
+    }
+
+    bool tileCurrent(int x, int y) const {
+        return tileGeneration[(y / TILE) * TILES_X + x / TILE] == generation;
+    }
+
+    // Profundidad guardada, Format::Far si el tile no se ha tocado en este frame
+    Stored get(int x, int y) const {
+        return tileCurrent(x, y) ? depth(x, y) : Format::Far;
+    }
+
+    // Ningun modelo cubrio el pixel
+    bool isFar(int x, int y) const {
+        return get(x, y) == Format::Far;
+    }
+
+    // Profundidad mas lejana del tile (tx, ty); un fragmento que no este mas cerca que esto no
+    // puede pasar en ningun pixel del tile
+    Stored farthest(int tx, int ty) {
+        int t = ty * TILES_X + tx;
+        if (tileGeneration[t] != generation) {
+            return Format::Far;
+        }
+        if (tileDirty[t]) {
+            int x0 = tx * TILE;
+            int x1 = std::min(x0 + TILE, Width);
+            int y1 = std::min((ty + 1) * TILE, Height);
+            Stored result = depth(x0, ty * TILE);
+            for (int y = ty * TILE; y < y1; ++y) {
+                for (int x = x0; x < x1; ++x) {
+                    if (Format::closer(result, depth(x, y))) {
+                        result = depth(x, y);
+                    }
+                }
+            }
+            tileFarthest[t] = result;
+            tileDirty[t] = false;
+        }
+        return tileFarthest[t];
+    }
+
+    // Prueba de profundidad con z ya codificada; si esta mas cerca la guarda y devuelve true
+    bool testAndSet(int x, int y, Stored z) {
+        int t = (y / TILE) * TILES_X + x / TILE;
+        if (tileGeneration[t] != generation) {
+            fillTile(x / TILE, y / TILE);
+            tileGeneration[t] = generation;
+        }
+
+        Stored& stored = depth(x, y);
+        if (Format::closer(z, stored)) {
+            stored = z;
+            tileDirty[t] = true;
+            return true;
+        }
+        return false;
+    }
+
+private:
+    void fillTile(int tx, int ty) {
+        int x0 = tx * TILE;
+        int x1 = std::min(x0 + TILE, Width);
+        int y1 = std::min((ty + 1) * TILE, Height);
+        for (int y = ty * TILE; y < y1; ++y) {
+            for (int x = x0; x < x1; ++x) {
+                depth(x, y) = Format::Far;
+            }
+        }
+        tileFarthest[ty * TILES_X + tx] = Format::Far;
+        tileDirty[ty * TILES_X + tx] = false;
+    }
+};
+
+// Pixeles que el modo pintor ya cubrio en el frame (sin profundidad). Usa la misma generacion
+// por tile que DepthBuffer: clear() no recorre nada y un tile que nadie pinto cuenta como
+// vacio sin leer sus pixeles
+template <int Width, int Height, typename Layout = BufferLayout>
+struct CoverageMask {
+    static constexpr int TILE = 8;
+    static constexpr int TILES_X = (Width + TILE - 1) / TILE;
+    static constexpr int TILES_Y = (Height + TILE - 1) / TILE;
+
+    ScreenBuffer<uint8_t, Width, Height, Layout> covered;
+    std::array<uint32_t, TILES_X * TILES_Y> tileGeneration{}; // 0: nunca usado
+    uint32_t generation = 1;
+
+    void clear() {
+        ++generation;
+        if (generation == 0) {
+            tileGeneration.fill(0);
+            generation = 1;
+        }
+    }
+
+    void mark(int x, int y) {
+        int t = (y / TILE) * TILES_X + x / TILE;
+        if (tileGeneration[t] != generation) {
+            int x0 = (x / TILE) * TILE;
+            int x1 = std::min(x0 + TILE, Width);
+            int y1 = std::min((y / TILE + 1) * TILE, Height);
+            for (int ty = (y / TILE) * TILE; ty < y1; ++ty) {
+                for (int tx = x0; tx < x1; ++tx) {
+                    covered(tx, ty) = 0;
+                }
+            }
+            tileGeneration[t] = generation;
+        }
+        covered(x, y) = 1;
+    }
+
+    bool isCovered(int x, int y) const {
+        return tileGeneration[(y / TILE) * TILES_X + x / TILE] == generation && covered(x, y);
+    }
+};
@@ -7,15 +7,37 @@ struct Fragment {
     glm::vec3 position; // X and Y coordinates of the pixel (in screen space)
     Color color = Color(0, 0, 0);
     float intensity;
-    glm::vec3 worldPos;
-    glm::vec3 originalPos;
+};
+
+// Extra attribute a material reads besides depth and lighting. Each material declares one
+// (see shaderVarying) and only that one is computed, stored and interpolated.
+enum class Varying {
+    None,
+    OriginalPos,  // object-space position
+    WorldPos,
+    Tex,
+};
+
+// Number of fragments the rasterizer packs into a span before handing it to a material
+constexpr int SPAN_SIZE = 16;
+
+// Block of fragments stored as structure-of-arrays, so a material can shade the whole span
+// in one call and the compiler can run the noise and color math over several pixels at once
+struct FragmentSpan {
+    int count = 0;
+    alignas(64) int x[SPAN_SIZE];
+    alignas(64) int y[SPAN_SIZE];
+    alignas(64) float z[SPAN_SIZE];
+    alignas(64) float ox[SPAN_SIZE]; // the material's varying (originalPos for the planets)
+    alignas(64) float oy[SPAN_SIZE];
+    alignas(64) float oz[SPAN_SIZE];
+    alignas(64) float intensity[SPAN_SIZE];
+    Color color[SPAN_SIZE];
 };
 
 struct Vertex {
     glm::vec3 position;
     glm::vec3 normal;
-    glm::vec3 tex;
-    glm::vec3 worldPos;
-    glm::vec3 originalPos;
+    glm::vec3 varying; // Attribute selected by the material's Varying, unset for Varying::None
 };
 
@@ -10,6 +10,8 @@
 #include "color.h"
 #include "fragment.h"
 #include "noise.h"
+#include "depth.h"
+#include "atomicbuffer.h"
 
 
 struct Face {
@@ -20,18 +22,62 @@ struct Face {
 
 SDL_Window* window = nullptr;
 SDL_Renderer* renderer = nullptr;
+SDL_Texture* texture = nullptr;
 const int SCREEN_WIDTH = 1280;
 const int SCREEN_HEIGHT = 720;
 
 Color clearColor = {0, 0, 0, 255}; // Initially set to black
-std::array<std::array<float, SCREEN_WIDTH>, SCREEN_HEIGHT> zbuffer;
+DepthBuffer<SCREEN_WIDTH, SCREEN_HEIGHT> zbuffer;
+CoverageMask<SCREEN_WIDTH, SCREEN_HEIGHT> painted; // lo que cubrio el modo pintor
+
+// Cuantos framebuffers rotan entre el render y present(): con 2 el render que termina un frame
+// mientras el anterior se sube a la textura espera a que acabe la subida; con 3 empieza el
+// siguiente en el tercero, a cambio de mas memoria (GC_FRAMEBUFFERS en CMakeLists.txt). En
+// --lockstep el render nunca se adelanta y da igual cuantos haya
+#ifndef GC_FRAMEBUFFERS
+#define GC_FRAMEBUFFERS 2
+#endif
+constexpr int FRAMEBUFFER_COUNT = GC_FRAMEBUFFERS;
+static_assert(FRAMEBUFFER_COUNT >= 2, "hacen falta al menos 2 framebuffers");
+
+// Color del frame en CPU; Color guarda r, g, b, a en ese orden de bytes (SDL_PIXELFORMAT_RGBA32).
+// Esta en BufferLayout (tiles, por defecto) y present() lo pasa a filas al subirlo a la textura
+using Framebuffer = ScreenBuffer<Color, SCREEN_WIDTH, SCREEN_HEIGHT>;
+std::vector<Framebuffer> framebuffers;
+Framebuffer* framebuffer = nullptr; // el que esta dibujando el render
+
+// Profundidad y color empacados para RenderMode::Atomic; resolve() lo pasa a framebuffer
+AtomicDepthColorBuffer<SCREEN_WIDTH, SCREEN_HEIGHT> atomicbuffer;
 
 // Function to set a specific pixel in the framebuffer to the currentColor
 void point(Fragment f) {
-    if (f.position.z < zbuffer[f.position.y][f.position.x]) {
-        SDL_SetRenderDrawColor(renderer, f.color.r, f.color.g, f.color.b, f.color.a);
-        SDL_RenderDrawPoint(renderer, f.position.x, f.position.y);
-        zbuffer[f.position.y][f.position.x] = f.position.z;
+    if (zbuffer.testAndSet(f.position.x, f.position.y, DepthFormat::encode(f.position.z))) {
+        (*framebuffer)(f.position.x, f.position.y) = f.color;
+    }
+}
+
+// Depth-tests and writes every shaded fragment of the span
+void point(const FragmentSpan& span) {
+    for (int i = 0; i < span.count; ++i) {
+        if (zbuffer.testAndSet(span.x[i], span.y[i], DepthFormat::encode(span.z[i]))) {
+            (*framebuffer)(span.x[i], span.y[i]) = span.color[i];
+        }
+    }
+}
+
+// Modo pintor: escribe el span encima de lo que haya, sin leer ni escribir profundidad; solo
+// marca los pixeles cubiertos para que el cielo no los muestree
+void paint(const FragmentSpan& span) {
+    for (int i = 0; i < span.count; ++i) {
+        (*framebuffer)(span.x[i], span.y[i]) = span.color[i];
+        painted.mark(span.x[i], span.y[i]);
+    }
+}
+
+// Escribe el span con min atomico; puede llamarse desde cualquier hilo a la vez
+void pointAtomic(const FragmentSpan& span) {
+    for (int i = 0; i < span.count; ++i) {
+        atomicbuffer.write(span.x[i], span.y[i], span.z[i], span.color[i]);
     }
 }
 
@@ -53,54 +99,44 @@ bool init() {
         return false;
     }
 
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STREAMING, SCREEN_WIDTH, SCREEN_HEIGHT);
+    if (!texture) {
+        std::cerr << "Error: Failed to create SDL texture: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    framebuffers.resize(FRAMEBUFFER_COUNT);
+    framebuffer = &framebuffers[0];
+
     setupNoise();
 
     return true;
 }
 
-float ox = 1200.0f;
-float oy = 3000.0f;
-
 // Function to clear the framebuffer with the clearColor
+// Solo se limpia la profundidad, y sin recorrerla: los tiles se limpian al primer uso.
+// drawSkybox() pinta despues cada pixel que quede lejano y sin pintar
 void clear() {
-    SDL_SetRenderDrawColor(renderer, clearColor.r, clearColor.g, clearColor.b, clearColor.a);
-    SDL_RenderClear(renderer);
+    zbuffer.clear();
+    painted.clear();
+}
 
-    // Clean the zbuffer
-    for (auto &row : zbuffer) {
-        std::fill(row.begin(), row.end(), 99999.0f);
+// Pasa un framebuffer terminado a filas directamente en la textura y lo muestra
+void present(const Framebuffer& frame) {
+    void* pixels;
+    int pitch;
+    if (SDL_LockTexture(texture, nullptr, &pixels, &pitch) == 0) {
+        frame.toLinear(pixels, pitch);
+        SDL_UnlockTexture(texture);
     }
+    SDL_RenderCopy(renderer, texture, nullptr, nullptr);
+    SDL_RenderPresent(renderer);
+}
 
-    // Generate stars
-    int numStars = 2500;
-    FastNoiseLite noise;
-    noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-
-    ox += 0.001f;
-    oy += 0.001f;
-
-
-    for (int i = 0; i < numStars; i += 5) {
-        float x = noise.GetNoise((float)i + ox, oy) * SCREEN_WIDTH;
-        float y = noise.GetNoise((float)i + oy, ox) * SCREEN_HEIGHT;
-        float z = noise.GetNoise((float)i + ox, oy) * 100.0f;
-
-        x = std::abs(x);
-        y = std::abs(y);
-        z = std::abs(z);
-
-//        std::cout << x << ", " << y << ", " << z << std::endl;
-
-        float size = noise.GetNoise((float)i + ox, oy) * 5.0f;
-
-        Fragment f = {
-            {x, y, z},
-            Color{255, 255, 255},
-            size
-        };
-
-        point(f);
-    }
+// Vuelve a mostrar lo que ya esta en la textura, sin subir pixeles
+void presentAgain() {
+    SDL_RenderCopy(renderer, texture, nullptr, nullptr);
+    SDL_RenderPresent(renderer);
 }
 
 
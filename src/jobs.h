@@ -0,0 +1,330 @@
+// jobs.h
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool de hilos con robo de trabajo, compartido por todas las etapas (texturas, cielo, carga de
+// modelos, sombreado). Cada hilo tiene su propia cola: saca de atras lo ultimo que metio (asi
+// lo que sigue suele estar aun en su cache) y los demas le roban de adelante cuando se quedan
+// sin trabajo. Los hilos de fuera del pool (el principal y el de render) no tienen cola propia:
+// lo que encolan va a una cola de entrada compartida, de la que todos sacan de adelante. El hilo
+// que espera un resultado no se duerme: ejecuta tareas mientras tanto, asi un parallelFor dentro
+// de otra tarea no bloquea el pool.
+
+// Cuenta tareas pendientes de un grupo; wait() vuelve cuando llega a 0
+struct TaskCounter {
+    std::atomic<int> pending{0};
+};
+
+struct Job {
+    std::function<void()> run;
+    TaskCounter* counter = nullptr;
+};
+
+class JobSystem {
+public:
+    // Estadisticas por hilo desde el ultimo resetStats()
+    struct WorkerStats {
+        std::atomic<long> tasksRun{0};
+        std::atomic<long> steals{0};
+        std::atomic<long> idleMicroseconds{0};
+    };
+
+    // workers hilos ademas de los que llaman; por defecto uno por nucleo restante
+    explicit JobSystem(int workers = std::max(1u, std::thread::hardware_concurrency()) - 1)
+        : queues(workers), stats(workers) {
+        statsStart = std::chrono::steady_clock::now();
+        for (int i = 0; i < workers; ++i) {
+            threads.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    int threadCount() const { return int(queues.size()); }
+
+    // Encola fn en la cola del hilo actual, o en la de entrada si no es un hilo del pool
+    void submit(std::function<void()> fn, TaskCounter* counter = nullptr) {
+        if (counter) {
+            counter->pending.fetch_add(1, std::memory_order_relaxed);
+        }
+        int index = currentIndex();
+        Queue& queue = index == EXTERNAL ? injection : queues[index];
+        queued.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(Job{std::move(fn), counter});
+        }
+        // El lock evita que un hilo se duerma entre revisar queued y esperar
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        wake.notify_one();
+    }
+
+    // Ejecuta tareas hasta que el grupo termina. Sin tareas a mano gira un poco y despues se
+    // duerme hasta que llegue trabajo o termine el grupo, asi los hilos de fuera del pool no le
+    // quitan nucleos a los workers. El tiempo sin trabajo cuenta como idle del hilo
+    void wait(const TaskCounter& counter) {
+        int index = currentIndex();
+        WorkerStats& s = index == EXTERNAL ? externalStats : stats[index];
+        int misses = 0;
+        auto idleStart = std::chrono::steady_clock::now();
+        while (counter.pending.load(std::memory_order_acquire) > 0) {
+            Job job;
+            if (findJob(index, job)) {
+                if (misses > 0) {
+                    addIdle(s, idleStart);
+                    misses = 0;
+                }
+                execute(index, job);
+                continue;
+            }
+            if (misses++ == 0) {
+                idleStart = std::chrono::steady_clock::now();
+            }
+            if (misses < SPIN_TRIES) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait(lock, [this, &counter] {
+                return counter.pending.load(std::memory_order_acquire) == 0 || queued.load(std::memory_order_acquire) > 0;
+            });
+        }
+        if (misses > 0) {
+            addIdle(s, idleStart);
+        }
+    }
+
+    void printStats() const {
+        double elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - statsStart).count();
+        for (int i = 0; i < threadCount(); ++i) {
+            const WorkerStats& s = stats[i];
+            std::cout << "Jobs worker " << i << ": " << s.tasksRun << " tasks, " << s.steals << " steals";
+            if (elapsed > 0.0) {
+                std::cout << ", " << 100.0 * s.idleMicroseconds / elapsed << "% idle";
+            }
+            std::cout << std::endl;
+        }
+        // Tareas que corrieron los hilos de fuera del pool mientras esperaban, y cuanto esperaron
+        // sin trabajo (sumando todos esos hilos)
+        std::cout << "Jobs external threads: " << externalStats.tasksRun << " tasks, "
+                  << externalStats.idleMicroseconds / 1000.0 << " ms idle in wait()" << std::endl;
+    }
+
+    void resetStats() {
+        for (WorkerStats& s : stats) {
+            s.tasksRun = 0;
+            s.steals = 0;
+            s.idleMicroseconds = 0;
+        }
+        externalStats.tasksRun = 0;
+        externalStats.idleMicroseconds = 0;
+        statsStart = std::chrono::steady_clock::now();
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    // Indice de los hilos que no son del pool
+    static constexpr int EXTERNAL = -1;
+    // Intentos de buscar trabajo en wait() antes de dormirse
+    static constexpr int SPIN_TRIES = 64;
+
+    std::vector<Queue> queues;
+    Queue injection; // lo que encolan los hilos de fuera del pool
+    std::vector<WorkerStats> stats;
+    WorkerStats externalStats;
+    std::vector<std::thread> threads;
+    std::atomic<int> queued{0};
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+    std::chrono::steady_clock::time_point statsStart;
+
+    static int& workerIndex() {
+        thread_local int index = EXTERNAL;
+        return index;
+    }
+
+    int currentIndex() const {
+        return workerIndex();
+    }
+
+    // Primero la cola propia (lo ultimo que entro), despues la de entrada y despues robar de
+    // adelante de las otras. Los hilos de fuera del pool solo sacan de adelante
+    bool findJob(int index, Job& job) {
+        if (queued.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        if (index != EXTERNAL && pop(queues[index], job, true)) {
+            return true;
+        }
+        if (pop(injection, job, false)) {
+            return true;
+        }
+        int start = index == EXTERNAL ? 0 : index + 1;
+        for (int offset = 0; offset < threadCount(); ++offset) {
+            int victim = (start + offset) % threadCount();
+            if (victim != index && pop(queues[victim], job, false)) {
+                if (index != EXTERNAL) {
+                    stats[index].steals.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool pop(Queue& queue, Job& job, bool back) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty()) {
+            return false;
+        }
+        if (back) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        } else {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void execute(int index, Job& job) {
+        job.run();
+        WorkerStats& s = index == EXTERNAL ? externalStats : stats[index];
+        s.tasksRun.fetch_add(1, std::memory_order_relaxed);
+        // Al terminar el grupo se despierta a quien lo espera dormido en wait()
+        if (job.counter && job.counter->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            { std::lock_guard<std::mutex> lock(sleepMutex); }
+            wake.notify_all();
+        }
+    }
+
+    static void addIdle(WorkerStats& s, std::chrono::steady_clock::time_point since) {
+        auto idle = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - since);
+        s.idleMicroseconds.fetch_add(idle.count(), std::memory_order_relaxed);
+    }
+
+    void workerLoop(int index) {
+        workerIndex() = index;
+        while (true) {
+            Job job;
+            if (findJob(index, job)) {
+                execute(index, job);
+                continue;
+            }
+
+            auto idleStart = std::chrono::steady_clock::now();
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wake.wait(lock, [this] { return stopping || queued.load(std::memory_order_acquire) > 0; });
+                if (stopping) {
+                    return;
+                }
+            }
+            addIdle(stats[index], idleStart);
+        }
+    }
+};
+
+// Pool del programa, se crea en el primer uso
+inline JobSystem& jobSystem() {
+    static JobSystem system;
+    return system;
+}
+
+// Ejecuta fn(i) para i en [begin, end) en bloques de grain indices y espera a que terminen
+template <typename Fn>
+void parallelFor(int begin, int end, int grain, const Fn& fn) {
+    JobSystem& jobs = jobSystem();
+    TaskCounter counter;
+    for (int start = begin; start < end; start += grain) {
+        int stop = std::min(start + grain, end);
+        jobs.submit([&fn, start, stop] {
+            for (int i = start; i < stop; ++i) {
+                fn(i);
+            }
+        }, &counter);
+    }
+    jobs.wait(counter);
+}
+
+// Grafo de tareas: cada tarea arranca cuando terminaron todas las que se le dieron en after.
+// run() encola las que no dependen de nada y espera a que termine el grafo completo
+class TaskGraph {
+public:
+    using TaskId = int;
+
+    TaskId add(std::function<void()> fn, std::initializer_list<TaskId> after = {}) {
+        TaskId id = TaskId(nodes.size());
+        nodes.push_back(std::make_unique<Node>());
+        nodes[id]->run = std::move(fn);
+        for (TaskId dependency : after) {
+            nodes[dependency]->dependents.push_back(id);
+            nodes[id]->dependencies++;
+        }
+        return id;
+    }
+
+    void run(JobSystem& jobs = jobSystem()) {
+        TaskCounter counter;
+        for (auto& node : nodes) {
+            node->remaining = node->dependencies;
+        }
+        for (TaskId id = 0; id < TaskId(nodes.size()); ++id) {
+            if (nodes[id]->dependencies == 0) {
+                launch(jobs, id, counter);
+            }
+        }
+        jobs.wait(counter);
+    }
+
+private:
+    struct Node {
+        std::function<void()> run;
+        std::vector<TaskId> dependents;
+        int dependencies = 0;
+        std::atomic<int> remaining{0};
+    };
+
+    std::vector<std::unique_ptr<Node>> nodes;
+
+    // Al terminar, la ultima dependencia de cada sucesor lo encola; se encola antes de que esta
+    // tarea baje el contador, asi wait() no puede volver con trabajo pendiente
+    void launch(JobSystem& jobs, TaskId id, TaskCounter& counter) {
+        jobs.submit([this, &jobs, id, &counter] {
+            nodes[id]->run();
+            for (TaskId next : nodes[id]->dependents) {
+                if (nodes[next]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    launch(jobs, next, counter);
+                }
+            }
+        }, &counter);
+    }
+};
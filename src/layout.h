@@ -0,0 +1,108 @@
+// layout.h
+#pragma once
+#include <array>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Orden en memoria de los buffers de pantalla (color y profundidad). index(x, y, width) da la
+// posicion del pixel y size(width, height) cuantos elementos hay que reservar, contando el
+// relleno hasta completar tiles en los bordes.
+
+// Fila por fila, el orden de siempre: un triangulo alto toca una linea de cache por fila
+struct LinearLayout {
+    static constexpr int TILE = 1;
+
+    static constexpr int size(int width, int height) { return width * height; }
+    static int index(int x, int y, int width) { return y * width + x; }
+};
+
+// Tiles de Tile x Tile pixeles contiguos en memoria, fila por fila dentro del tile. Un tile
+// de 8x8 en RGBA32 son 256 bytes (4 lineas de cache); uno de 16x16, 1 KB
+template <int Tile>
+struct TiledLayout {
+    static_assert((Tile & (Tile - 1)) == 0, "Tile debe ser potencia de 2");
+    static constexpr int TILE = Tile;
+
+    static constexpr int size(int width, int height) {
+        return ((width + Tile - 1) / Tile) * ((height + Tile - 1) / Tile) * Tile * Tile;
+    }
+    static int index(int x, int y, int width) {
+        int tilesX = (width + Tile - 1) / Tile;
+        int tile = (y / Tile) * tilesX + x / Tile;
+        return tile * Tile * Tile + (y % Tile) * Tile + x % Tile;
+    }
+};
+
+// Como TiledLayout, pero dentro del tile los pixeles siguen la curva de Morton (bits de x e y
+// intercalados), asi cualquier bloque de 2x2, 4x4... del tile tambien es contiguo
+template <int Tile>
+struct MortonLayout {
+    static_assert((Tile & (Tile - 1)) == 0 && Tile <= 256, "Tile debe ser potencia de 2, hasta 256");
+    static constexpr int TILE = Tile;
+
+    static constexpr int size(int width, int height) { return TiledLayout<Tile>::size(width, height); }
+    static int index(int x, int y, int width) {
+        int tilesX = (width + Tile - 1) / Tile;
+        int tile = (y / Tile) * tilesX + x / Tile;
+        return tile * Tile * Tile + (spread[x % Tile] | (spread[y % Tile] << 1));
+    }
+
+private:
+    // spread[i]: los bits de i separados por un cero (0b101 -> 0b10001)
+    static constexpr std::array<uint16_t, Tile> spread = [] {
+        std::array<uint16_t, Tile> table{};
+        for (int i = 0; i < Tile; ++i) {
+            for (int bit = 0; bit < 8; ++bit) {
+                table[i] |= ((i >> bit) & 1) << (2 * bit);
+            }
+        }
+        return table;
+    }();
+};
+
+using LayoutLinear = LinearLayout;
+using LayoutTiled8 = TiledLayout<8>;
+using LayoutTiled16 = TiledLayout<16>;
+using LayoutMorton8 = MortonLayout<8>;
+using LayoutMorton16 = MortonLayout<16>;
+
+// Layout de los buffers, se elige al compilar (GC_BUFFER_LAYOUT en CMakeLists.txt)
+#ifndef GC_BUFFER_LAYOUT
+#define GC_BUFFER_LAYOUT LayoutTiled8
+#endif
+using BufferLayout = GC_BUFFER_LAYOUT;
+
+// Buffer de pantalla en el layout dado. Solo present() lo pasa a filas con toLinear()
+template <typename T, int Width, int Height, typename Layout = BufferLayout>
+struct ScreenBuffer {
+    std::array<T, Layout::size(Width, Height)> data;
+
+    T& operator()(int x, int y) { return data[Layout::index(x, y, Width)]; }
+    const T& operator()(int x, int y) const { return data[Layout::index(x, y, Width)]; }
+
+    // Copia el buffer a una imagen fila por fila con pitch bytes por fila. Recorre la memoria
+    // del buffer en orden, tile por tile
+    void toLinear(void* pixels, int pitch) const {
+        if constexpr (std::is_same_v<Layout, LinearLayout>) {
+            for (int y = 0; y < Height; ++y) {
+                std::memcpy(static_cast<uint8_t*>(pixels) + size_t(y) * pitch, &data[y * Width], Width * sizeof(T));
+            }
+        } else {
+            constexpr int TILE = Layout::TILE;
+            for (int ty = 0; ty < Height; ty += TILE) {
+                int y1 = std::min(ty + TILE, Height);
+                for (int tx = 0; tx < Width; tx += TILE) {
+                    int x1 = std::min(tx + TILE, Width);
+                    for (int y = ty; y < y1; ++y) {
+                        T* row = reinterpret_cast<T*>(static_cast<uint8_t*>(pixels) + size_t(y) * pitch);
+                        for (int x = tx; x < x1; ++x) {
+                            row[x] = (*this)(x, y);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
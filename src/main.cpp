@@ -5,95 +5,557 @@
 #include "shaders.h"
 #include "object.h"
 #include "triangle.h"
+#include "skybox.h"
+#include "sortlast.h"
+#include "pipeline.h"
+#include "pacing.h"
+#include "simulation.h"
 #include <iostream>
 #include <vector>
+#include <limits>
 
 Camera camera = setupInitialCamera();
-std::vector<Model> models;
+bool painterMode = true; // esferas sin z-buffer cuando el orden lo permite (tecla P)
+NoiseQuality noiseQuality = NoiseQuality::Exact; // tecla Q; el render la recibe en FrameState
+
+// Como se reparte la rasterizacion y como se resuelve la visibilidad (tecla M)
+enum class RenderMode {
+    ZBuffer, // un hilo rasteriza los modelos en orden con el z-buffer (o modo pintor)
+    Atomic,  // todos los hilos rasterizan triangulos de cualquier modelo y escriben con min atomico
+    SortLast, // cada modelo en su propia imagen parcial, combinadas al final por profundidad
+    Binned,   // triangulos repartidos por tiles de 8x8, cada tile en una tarea con su z-buffer en orden
+};
+RenderMode renderMode = RenderMode::ZBuffer;
+
+// Todo lo que el hilo de render necesita de un frame; el hilo principal llena una copia
+// mientras el render lee otra (pipeline.h)
+struct FrameState {
+    std::vector<Model> models;
+    // Vertices transformados de cada modelo, en el mismo orden que models. Se reusan de un
+    // frame a otro para no volver a reservar memoria
+    std::vector<std::vector<Vertex>> transformedModels;
+    glm::mat4 view;
+    glm::mat4 projection;
+    RenderMode renderMode = RenderMode::ZBuffer;
+    bool painterMode = true;
+    NoiseQuality noiseQuality = NoiseQuality::Exact;
+};
+
+// Todo lo que decide la imagen de un frame. Si no cambio desde el ultimo frame dibujado, dibujar
+// otra vez da los mismos pixeles. Los shaders no dependen del tiempo, asi que basta con la camara,
+// los angulos de la escena y los modos
+struct FrameInputs {
+    Camera camera;
+    SolarSystemState scene;
+    RenderMode renderMode = RenderMode::ZBuffer;
+    bool painterMode = true;
+    NoiseQuality noiseQuality = NoiseQuality::Exact;
+};
+
+bool sameInputs(const FrameInputs& a, const FrameInputs& b) {
+    return a.camera.cameraPosition == b.camera.cameraPosition && a.camera.targetPosition == b.camera.targetPosition &&
+           a.camera.upVector == b.camera.upVector && a.scene == b.scene && a.renderMode == b.renderMode &&
+           a.painterMode == b.painterMode && a.noiseQuality == b.noiseQuality;
+}
+
+// Triangulos por tarea en RenderMode::Atomic
+constexpr int TRIANGLE_BATCH = 256;
+// Tiles por tarea en RenderMode::Binned
+constexpr int TILE_BATCH = 8;
 std::string planet;
 bool hasMoon = false;
 
 using namespace std;
-void render() {
-    for (auto model : models) {
-        Uniforms uniform = model.uniforms;
-        uniform.model = model.modelMatrix;
 
-        // 1. Vertex Shader
-        // vertex -> transformedVertices
-        std::vector<Vertex> transformedVertices;
+// Vertices en batches de este tamano por tarea del pool
+constexpr int VERTEX_BATCH = 1024;
+
+// 1. Vertex Shader
+// vertex -> transformedVertices, carrying only the varying V the material reads. The output is
+// sized up front and each batch writes its own range, so the pool needs no locks
+template <Varying V>
+void transformVertices(const Model& model, const Uniforms& uniform, std::vector<Vertex>& transformedVertices) {
+    const std::vector<glm::vec3>& vertices = *model.vertices;
+    int count = int(vertices.size() / 3);
+    transformedVertices.resize(count);
+
+    parallelFor(0, (count + VERTEX_BATCH - 1) / VERTEX_BATCH, 1, [&](int batch) {
+        int end = std::min(count, (batch + 1) * VERTEX_BATCH);
+        for (int i = batch * VERTEX_BATCH; i < end; ++i) {
+            transformedVertices[i] = vertexShader<V>(vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2], uniform);
+        }
+    });
+}
+
+// Uniforms del modelo con su matriz de este frame
+Uniforms modelUniforms(const Model& model) {
+    Uniforms uniform = model.uniforms;
+    uniform.model = model.modelMatrix;
+    return uniform;
+}
 
-        for (int i = 0; i < model.vertices.size(); i+=3) {
-            glm::vec3 v = model.vertices[i];
-            glm::vec3 n = model.vertices[i+1];
-            glm::vec3 t = model.vertices[i+2];
+// Etapa de vertices de todos los modelos: los modelos van en paralelo y los grandes ademas se
+// parten en batches
+void vertexStage(FrameState& frame) {
+    const std::vector<Model>& models = frame.models;
+    std::vector<std::vector<Vertex>>& transformedModels = frame.transformedModels;
+    transformedModels.resize(models.size());
+    parallelFor(0, int(models.size()), 1, [&](int m) {
+        const Model& model = models[m];
+        Uniforms uniform = modelUniforms(model);
+        switch (shaderVarying(model.shader)) {
+            case Varying::None:
+                transformVertices<Varying::None>(model, uniform, transformedModels[m]);
+                break;
+            case Varying::OriginalPos:
+                transformVertices<Varying::OriginalPos>(model, uniform, transformedModels[m]);
+                break;
+            case Varying::WorldPos:
+                transformVertices<Varying::WorldPos>(model, uniform, transformedModels[m]);
+                break;
+            case Varying::Tex:
+                transformVertices<Varying::Tex>(model, uniform, transformedModels[m]);
+                break;
+        }
+    });
+}
 
-            auto vertex = Vertex{v, n, t};
+// Primitive assembly and rasterization of triangles [first, last) of one model from its
+// transformed vertices. Sphere models drop their back faces before rasterizing
+template <Varying V, bool DepthTest>
+void rasterizeModel(const Model& model, const std::vector<Vertex>& transformedVertices, int first, int last, std::vector<FragmentSpan>& spans) {
+    // 2. Primitive Assembly + 3. Rasterize
+    // each 3 consecutive vertices -> Fragment spans
+    for (size_t i = 3 * size_t(first); i < 3 * size_t(last); i += 3) {
+        const Vertex& a = transformedVertices[i];
+        const Vertex& b = transformedVertices[i + 1];
+        const Vertex& c = transformedVertices[i + 2];
+        if (model.sphere && backFacing(a.position, b.position, c.position)) {
+            continue;
+        }
+        triangle<V, DepthTest>(a, b, c, spans);
+    }
+}
 
-            Vertex transformedVertex = vertexShader(vertex, uniform);
-            transformedVertices.push_back(transformedVertex);
+// Orden de dibujo del frame: primero el pase Foreground, luego los opacos del mas cercano al mas
+// lejano segun el punto mas cercano de su esfera envolvente, para que el early-z descarte lo que
+// quede detras antes de sombrearlo, y al final los transparentes de atras hacia adelante
+void sortModels(std::vector<Model>& modelsToSort, const glm::mat4& view) {
+    auto nearestDepth = [&](const Model& model) {
+        BoundingSphere sphere = viewBounds(model, view);
+        return -sphere.center.z - sphere.radius;
+    };
+
+    std::vector<std::pair<float, Model*>> order;
+    for (Model& model : modelsToSort) {
+        float depth = nearestDepth(model);
+        order.emplace_back(model.pass == DrawPass::Transparent ? -depth : depth, &model);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const auto& a, const auto& b) {
+        if (a.second->pass != b.second->pass) {
+            return a.second->pass < b.second->pass;
         }
+        return a.first < b.first;
+    });
 
-        // 2. Primitive Assembly
-        // transformedVertices -> triangles
-        std::vector<std::vector<Vertex>> triangles = primitiveAssembly(transformedVertices);
+    std::vector<Model> sorted;
+    sorted.reserve(modelsToSort.size());
+    for (const auto& entry : order) {
+        sorted.push_back(std::move(*entry.second));
+    }
+    modelsToSort = std::move(sorted);
+}
 
+// Material de cada shader sobre un span
+void shadeSpan(Shader shader, FragmentSpan& span, NoiseQuality quality) {
+    switch (shader) {
+        case Shader::Earth:
+            earthFragmentShader(span, quality);
+            break;
+        case Shader::Sun:
+            sunFragmentShader(span, quality);
+            break;
+        case Shader::Moon:
+            moonFragmentShader(span, quality);
+            break;
+        case Shader::Jupiter:
+            jupiterFragmentShader(span, quality);
+            break;
+        case Shader::Uranus:
+            uranusFragmentShader(span, quality);
+            break;
+        case Shader::Mars:
+            plutoFragmentShader(span, quality);
+            break;
+        case Shader::Kepler186f:
+            keplerFragmentShader(span, quality);
+            break;
+        case Shader::Noise:
+            noiseFragmentShader(span, quality);
+            break;
+        case Shader::Ship:
+            shipFragmentShader(span);
+            break;
+        default:
+            fragmentShader(span);
+            break;
+    }
+}
 
-        // 3. Rasterize
-        // triangles -> Fragments
-        std::vector<Fragment> fragments;
-        for (const std::vector<Vertex>& triangleVertices : triangles) {
-            std::vector<Fragment> rasterizedTriangle = triangle(
-                    triangleVertices[0],
-                    triangleVertices[1],
-                    triangleVertices[2]
-            );
+// Rasteriza, sombrea y escribe un modelo; sin DepthTest los fragmentos se pintan encima
+template <bool DepthTest>
+void rasterize(const Model& model, const std::vector<Vertex>& transformedVertices, int first, int last, std::vector<FragmentSpan>& spans) {
+    switch (shaderVarying(model.shader)) {
+        case Varying::None:
+            rasterizeModel<Varying::None, DepthTest>(model, transformedVertices, first, last, spans);
+            break;
+        case Varying::OriginalPos:
+            rasterizeModel<Varying::OriginalPos, DepthTest>(model, transformedVertices, first, last, spans);
+            break;
+        case Varying::WorldPos:
+            rasterizeModel<Varying::WorldPos, DepthTest>(model, transformedVertices, first, last, spans);
+            break;
+        case Varying::Tex:
+            rasterizeModel<Varying::Tex, DepthTest>(model, transformedVertices, first, last, spans);
+            break;
+    }
+}
 
-            fragments.insert(
-                    fragments.end(),
-                    rasterizedTriangle.begin(),
-                    rasterizedTriangle.end()
-            );
+template <bool DepthTest>
+void drawModel(const Model& model, const std::vector<Vertex>& transformedVertices, NoiseQuality quality) {
+    // Todo el modelo se rasteriza en el hilo de render; RenderMode::Binned reparte este mismo
+    // trabajo por tiles en el pool
+    std::vector<FragmentSpan> spans;
+    rasterize<DepthTest>(model, transformedVertices, 0, int(transformedVertices.size() / 3), spans);
+
+
+    // 4. Fragment Shader
+    // Fragment spans -> colors
+    // Los spans se sombrean en paralelo; la prueba de profundidad y la escritura siguen en orden
+    parallelFor(0, int(spans.size()), 4, [&](int i) {
+        shadeSpan(model.shader, spans[i], quality);
+    });
+
+    for (const FragmentSpan& span : spans) {
+        if constexpr (DepthTest) {
+            point(span);
+        } else {
+            paint(span);
         }
+    }
+}
 
+// El modo pintor es correcto si las esferas no se cortan entre si, la camara esta fuera de
+// todas (y del plano cercano) y todo lo que no es esfera queda completamente delante de ellas;
+// eso ultimo se dibuja despues con z-buffer, que solo lo tiene a el
+bool painterOrderHolds(const std::vector<Model>& modelsToCheck, const glm::mat4& view) {
+    const float nearClip = 0.1f;
+    float nearestSphere = std::numeric_limits<float>::max();
+    float farthestOther = -std::numeric_limits<float>::max();
+
+    for (size_t i = 0; i < modelsToCheck.size(); ++i) {
+        BoundingSphere a = viewBounds(modelsToCheck[i], view);
+        if (!modelsToCheck[i].sphere) {
+            farthestOther = std::max(farthestOther, -a.center.z + a.radius);
+            continue;
+        }
+        if (glm::length(a.center) - a.radius < nearClip) {
+            return false;
+        }
+        nearestSphere = std::min(nearestSphere, -a.center.z - a.radius);
 
-        // 4. Fragment Shader
-        // Fragments -> colors
+        for (size_t j = i + 1; j < modelsToCheck.size(); ++j) {
+            if (!modelsToCheck[j].sphere) {
+                continue;
+            }
+            BoundingSphere b = viewBounds(modelsToCheck[j], view);
+            if (glm::length(a.center - b.center) <= a.radius + b.radius) {
+                return false;
+            }
+        }
+    }
+    return farthestOther < nearestSphere;
+}
 
-        for (Fragment fragment : fragments) {
-            switch (model.shader) {
-                case Shader::Earth:
-                    point(earthFragmentShader(fragment));
-                    break;
-                case Shader::Sun:
-                    point(sunFragmentShader(fragment));
-                    break;
-                case Shader::Moon:
-                    point(moonFragmentShader(fragment));
-                    break;
-                case Shader::Jupiter:
-                    point(jupiterFragmentShader(fragment));
-                    break;
-                case Shader::Uranus:
-                    point(uranusFragmentShader(fragment));
-                    break;
-                case Shader::Mars:
-                    point(plutoFragmentShader(fragment));
-                    break;
-                case Shader::Kepler186f:
-                    point(keplerFragmentShader(fragment));
+// Quita los modelos que una esfera oclusora tapa por completo, antes de la etapa de vertices
+void cullOccluded(std::vector<Model>& modelsToCull, const glm::mat4& view) {
+    std::vector<BoundingSphere> occluders;
+    for (const Model& model : modelsToCull) {
+        if (model.occluderRadius > 0.0f) {
+            occluders.push_back(viewOccluder(model, view));
+        }
+    }
+
+    rasterStats.models += modelsToCull.size();
+    auto hidden = [&](const Model& model) {
+        BoundingSphere bounds = viewBounds(model, view);
+        for (const BoundingSphere& occluder : occluders) {
+            if (occludes(occluder, bounds)) {
+                return true;
+            }
+        }
+        return false;
+    };
+    auto end = std::remove_if(modelsToCull.begin(), modelsToCull.end(), hidden);
+    rasterStats.modelsOccluded += modelsToCull.end() - end;
+    modelsToCull.erase(end, modelsToCull.end());
+}
+
+// RenderMode::Atomic: cada tarea rasteriza, sombrea y escribe TRIANGLE_BATCH triangulos de
+// cualquier modelo; el min atomico de atomicbuffer resuelve la visibilidad sin importar el
+// orden. El cielo va primero en toda la pantalla y resolve() pinta encima los pixeles cubiertos
+void renderAtomic(const FrameState& frame) {
+    const std::vector<Model>& models = frame.models;
+    const std::vector<std::vector<Vertex>>& transformedModels = frame.transformedModels;
+    constexpr int CHUNK = 1 << 14;
+    const int pixels = atomicbuffer.size();
+    parallelFor(0, (pixels + CHUNK - 1) / CHUNK, 1, [&](int chunk) {
+        atomicbuffer.clear(chunk * CHUNK, std::min(pixels, (chunk + 1) * CHUNK));
+    });
+
+    drawSkybox(frame.view, frame.projection);
+
+    std::vector<std::pair<int, int>> batches; // modelo, primer triangulo
+    for (int m = 0; m < int(models.size()); ++m) {
+        int triangles = int(transformedModels[m].size() / 3);
+        for (int first = 0; first < triangles; first += TRIANGLE_BATCH) {
+            batches.emplace_back(m, first);
+        }
+    }
+
+    parallelFor(0, int(batches.size()), 1, [&](int b) {
+        const Model& model = models[batches[b].first];
+        const std::vector<Vertex>& transformedVertices = transformedModels[batches[b].first];
+        int first = batches[b].second;
+        int last = std::min(first + TRIANGLE_BATCH, int(transformedVertices.size() / 3));
+
+        std::vector<FragmentSpan> spans;
+        rasterize<false>(model, transformedVertices, first, last, spans);
+        for (FragmentSpan& span : spans) {
+            shadeSpan(model.shader, span, frame.noiseQuality);
+            pointAtomic(span);
+        }
+    });
+
+    parallelFor(0, (pixels + CHUNK - 1) / CHUNK, 1, [&](int chunk) {
+        atomicbuffer.resolve(*framebuffer, chunk * CHUNK, std::min(pixels, (chunk + 1) * CHUNK));
+    });
+}
+
+// Imagen parcial de cada modelo en RenderMode::SortLast, reusadas de un frame a otro
+std::vector<PartialImage> partialImages;
+
+// RenderMode::SortLast: cada modelo se dibuja en una tarea sobre su imagen parcial, recortada
+// a su rectangulo en pantalla. Luego, fila por fila en paralelo, las parciales se mezclan por
+// profundidad con SIMD y los pixeles cubiertos pasan al framebuffer, sobre el cielo
+void renderSortLast(const FrameState& frame) {
+    const std::vector<Model>& models = frame.models;
+    const std::vector<std::vector<Vertex>>& transformedModels = frame.transformedModels;
+    partialImages.resize(models.size());
+
+    parallelFor(0, int(models.size()), 1, [&](int m) {
+        const Model& model = models[m];
+        const std::vector<Vertex>& transformedVertices = transformedModels[m];
+        PartialImage& partial = partialImages[m];
+
+        float minX = SCREEN_WIDTH, minY = SCREEN_HEIGHT, maxX = -1.0f, maxY = -1.0f;
+        for (const Vertex& vertex : transformedVertices) {
+            minX = std::min(minX, vertex.position.x);
+            minY = std::min(minY, vertex.position.y);
+            maxX = std::max(maxX, vertex.position.x);
+            maxY = std::max(maxY, vertex.position.y);
+        }
+        partial.reset(std::max(0, int(std::floor(minX))), std::max(0, int(std::floor(minY))),
+                      std::min(SCREEN_WIDTH - 1, int(std::ceil(maxX))), std::min(SCREEN_HEIGHT - 1, int(std::ceil(maxY))));
+        if (partial.width == 0 || partial.height == 0) {
+            return;
+        }
+
+        std::vector<FragmentSpan> spans;
+        rasterize<false>(model, transformedVertices, 0, int(transformedVertices.size() / 3), spans);
+        parallelFor(0, int(spans.size()), 4, [&](int i) {
+            shadeSpan(model.shader, spans[i], frame.noiseQuality);
+        });
+        for (const FragmentSpan& span : spans) {
+            partial.write(span);
+        }
+    });
+
+    int x0 = SCREEN_WIDTH, y0 = SCREEN_HEIGHT, x1 = 0, y1 = 0;
+    for (const PartialImage& partial : partialImages) {
+        if (partial.width > 0 && partial.height > 0) {
+            x0 = std::min(x0, partial.x0);
+            y0 = std::min(y0, partial.y0);
+            x1 = std::max(x1, partial.x0 + partial.width);
+            y1 = std::max(y1, partial.y0 + partial.height);
+        }
+    }
+
+    drawSkybox(frame.view, frame.projection);
+
+    parallelFor(y0, y1, 8, [&](int y) {
+        clearSortLast(x0, y, x1, y + 1);
+        for (const PartialImage& partial : partialImages) {
+            compositeRow(partial, y);
+        }
+        resolveSortLast(x0, y, x1, y + 1);
+    });
+}
+
+// Triangulo de un modelo dentro de un bin de RenderMode::Binned
+struct BinnedTriangle {
+    int model;
+    int triangle;
+};
+
+// Un bin por tile del z-buffer, reusados de un frame a otro
+std::vector<std::vector<BinnedTriangle>> triangleBins;
+
+// Triangulos [first, last) de un bin, todos del mismo modelo, recortados a su tile
+template <Varying V>
+void rasterizeBin(const std::vector<Vertex>& transformedVertices, const std::vector<BinnedTriangle>& bin, size_t first, size_t last,
+                  const ClipRect& tile, std::vector<FragmentSpan>& spans, RasterStats& stats) {
+    for (size_t i = first; i < last; ++i) {
+        const Vertex* v = &transformedVertices[3 * size_t(bin[i].triangle)];
+        triangle<V, true>(v[0], v[1], v[2], spans, tile, stats);
+    }
+}
+
+// RenderMode::Binned: el hilo de render reparte los triangulos, en el orden de dibujo, entre los
+// bins de los tiles de 8x8 que toca su rectangulo. Cada tile es una tarea que rasteriza sus
+// triangulos recortados al tile, con el z jerarquico y el early-z de ese tile, sombrea y escribe
+// en el mismo orden. Ningun otro hilo toca ese tile, asi que la imagen es la del modo ZBuffer.
+// En las estadisticas del HiZ cada triangulo cuenta una vez por tile
+void renderBinned(const FrameState& frame) {
+    using Depth = decltype(zbuffer);
+    const std::vector<Model>& models = frame.models;
+    const std::vector<std::vector<Vertex>>& transformedModels = frame.transformedModels;
+    triangleBins.resize(Depth::TILES_X * Depth::TILES_Y);
+    for (std::vector<BinnedTriangle>& bin : triangleBins) {
+        bin.clear();
+    }
+
+    for (int m = 0; m < int(models.size()); ++m) {
+        const std::vector<Vertex>& transformedVertices = transformedModels[m];
+        int triangles = int(transformedVertices.size() / 3);
+        for (int t = 0; t < triangles; ++t) {
+            const glm::vec3& A = transformedVertices[3 * t].position;
+            const glm::vec3& B = transformedVertices[3 * t + 1].position;
+            const glm::vec3& C = transformedVertices[3 * t + 2].position;
+            if (models[m].sphere && backFacing(A, B, C)) {
+                continue;
+            }
+            ClipRect bounds = triangleBounds(A, B, C);
+            if (bounds.empty()) {
+                continue;
+            }
+            for (int ty = bounds.y0 / Depth::TILE; ty <= bounds.y1 / Depth::TILE; ++ty) {
+                for (int tx = bounds.x0 / Depth::TILE; tx <= bounds.x1 / Depth::TILE; ++tx) {
+                    triangleBins[ty * Depth::TILES_X + tx].push_back({m, t});
+                }
+            }
+        }
+    }
+
+    parallelFor(0, int(triangleBins.size()), TILE_BATCH, [&](int t) {
+        const std::vector<BinnedTriangle>& bin = triangleBins[t];
+        if (bin.empty()) {
+            return;
+        }
+        int x0 = (t % Depth::TILES_X) * Depth::TILE;
+        int y0 = (t / Depth::TILES_X) * Depth::TILE;
+        ClipRect tile{x0, y0, std::min(x0 + Depth::TILE, SCREEN_WIDTH) - 1, std::min(y0 + Depth::TILE, SCREEN_HEIGHT) - 1};
+
+        RasterStats stats;
+        std::vector<FragmentSpan> spans;
+        for (size_t first = 0; first < bin.size();) {
+            // Los triangulos seguidos del mismo modelo se sombrean juntos, como en drawModel
+            const Model& model = models[bin[first].model];
+            const std::vector<Vertex>& transformedVertices = transformedModels[bin[first].model];
+            size_t last = first + 1;
+            while (last < bin.size() && bin[last].model == bin[first].model) {
+                ++last;
+            }
+
+            spans.clear();
+            switch (shaderVarying(model.shader)) {
+                case Varying::None:
+                    rasterizeBin<Varying::None>(transformedVertices, bin, first, last, tile, spans, stats);
                     break;
-                case Shader::Noise:
-                    point(noiseFragmentShader(fragment));
+                case Varying::OriginalPos:
+                    rasterizeBin<Varying::OriginalPos>(transformedVertices, bin, first, last, tile, spans, stats);
                     break;
-                case Shader::Ship:
-                    point(shipFragmentShader(fragment));
+                case Varying::WorldPos:
+                    rasterizeBin<Varying::WorldPos>(transformedVertices, bin, first, last, tile, spans, stats);
                     break;
-                default:
-                    point(fragmentShader(fragment));
+                case Varying::Tex:
+                    rasterizeBin<Varying::Tex>(transformedVertices, bin, first, last, tile, spans, stats);
                     break;
             }
+            for (FragmentSpan& span : spans) {
+                shadeSpan(model.shader, span, frame.noiseQuality);
+                point(span);
+            }
+            first = last;
+        }
+        mergeRasterStats(stats);
+    });
+
+    drawSkybox(frame.view, frame.projection);
+}
+
+// Dibuja en el framebuffer el frame ya preparado (con su etapa de vertices hecha); corre en el
+// hilo de render. En modo pintor las esferas van de atras hacia adelante sin tocar la
+// profundidad, y el cielo al final solo donde no pinto nada. Para esferas disjuntas el orden correcto
+// es por potencia respecto a la camara (distancia^2 - radio^2), no por distancia al centro.
+// Si el orden no esta garantizado se usa el z-buffer como siempre
+void render(const FrameState& frame) {
+    const std::vector<Model>& models = frame.models;
+    const std::vector<std::vector<Vertex>>& transformedModels = frame.transformedModels;
+    const glm::mat4& view = frame.view;
+    const glm::mat4& projection = frame.projection;
+
+    clear();
+
+    if (frame.renderMode == RenderMode::Atomic) {
+        renderAtomic(frame);
+        return;
+    }
+    if (frame.renderMode == RenderMode::SortLast) {
+        renderSortLast(frame);
+        return;
+    }
+    if (frame.renderMode == RenderMode::Binned) {
+        renderBinned(frame);
+        return;
+    }
+
+    bool painter = frame.painterMode && painterOrderHolds(models, view);
+
+    if (painter) {
+        std::vector<std::pair<float, size_t>> spheres;
+        for (size_t m = 0; m < models.size(); ++m) {
+            if (models[m].sphere) {
+                BoundingSphere sphere = viewBounds(models[m], view);
+                spheres.emplace_back(glm::dot(sphere.center, sphere.center) - sphere.radius * sphere.radius, m);
+            }
+        }
+        std::sort(spheres.begin(), spheres.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        for (const auto& entry : spheres) {
+            drawModel<false>(models[entry.second], transformedModels[entry.second], frame.noiseQuality);
+        }
+        for (size_t m = 0; m < models.size(); ++m) {
+            if (!models[m].sphere) {
+                drawModel<true>(models[m], transformedModels[m], frame.noiseQuality);
+            }
         }
+        drawSkybox(view, projection);
+    } else {
+        for (size_t m = 0; m < models.size(); ++m) {
+            drawModel<true>(models[m], transformedModels[m], frame.noiseQuality);
+        }
+        drawSkybox(view, projection);
     }
 }
 
@@ -154,23 +616,47 @@ int main(int argc, char** argv) {
     std::vector<glm::vec3> shipNormals;
     std::vector<glm::vec3> shipTexCoords;
 
-    // Load the OBJ file
-    bool success = loadOBJ("../model/sphere.obj", planetVertices, planetFaces, planetNormals, planetTexCoords);
-    if (!success) {
-        std::cerr << "Error loading OBJ file!" << std::endl;
-        return 1;
-    }
-    success = loadOBJ("../model/quinjet.obj", shipVertices, shipFaces, shipNormals, shipTexCoords);
-    if (!success) {
+    std::vector<glm::vec3> planetVBO;
+    std::vector<glm::vec3> shipVBO;
+
+    // Carga de los OBJ y horneado del cielo en el pool: cada VBO espera solo a su archivo
+    bool planetLoaded = false;
+    bool shipLoaded = false;
+    TaskGraph loading;
+    TaskGraph::TaskId loadPlanet = loading.add([&] {
+        planetLoaded = loadOBJ("../model/sphere.obj", planetVertices, planetFaces, planetNormals, planetTexCoords);
+    });
+    TaskGraph::TaskId loadShip = loading.add([&] {
+        shipLoaded = loadOBJ("../model/quinjet.obj", shipVertices, shipFaces, shipNormals, shipTexCoords);
+    });
+    // Process the OBJ file into rotationAnglePlanet VBO
+    loading.add([&] {
+        if (planetLoaded) {
+            planetVBO = setupVertexFromObject(planetFaces, planetVertices, planetNormals, planetTexCoords);
+        }
+    }, {loadPlanet});
+    loading.add([&] {
+        if (shipLoaded) {
+            shipVBO = setupVertexFromObject(shipFaces, shipVertices, shipNormals, shipTexCoords);
+        }
+    }, {loadShip});
+    loading.add(bakeSkybox);
+    loading.run();
+
+    if (!planetLoaded || !shipLoaded) {
         std::cerr << "Error loading OBJ file!" << std::endl;
         return 1;
     }
 
-    // Process the OBJ file into rotationAnglePlanet VBO
-    std::vector<glm::vec3> planetVBO = setupVertexFromObject(planetFaces, planetVertices, planetNormals, planetTexCoords);
-    std::vector<glm::vec3> shipVBO = setupVertexFromObject(shipFaces, shipVertices, shipNormals, shipTexCoords);
+    BoundingSphere planetBounds = computeBounds(planetVBO);
+    BoundingSphere shipBounds = computeBounds(shipVBO);
+    float planetInnerRadius = computeInnerRadius(planetVBO, planetBounds.center);
+
+    // Los modelos comparten el VBO en lugar de copiarlo cada frame
+    auto planetMesh = std::make_shared<const std::vector<glm::vec3>>(std::move(planetVBO));
+    auto shipMesh = std::make_shared<const std::vector<glm::vec3>>(std::move(shipVBO));
 
-    Uint32 frameStart, frameTime; // For calculating the frames per second
+    FramePacer pacer(60.0); // Ritmo de frames, y de ahi los frames por segundo
 
     // ##################################### Ship #####################################
     Uniforms shipUniform = planetBaseUniform(camera);
@@ -182,9 +668,11 @@ int main(int argc, char** argv) {
 
     // Create model
     Model shipModel;
-    shipModel.vertices = shipVBO;
+    shipModel.vertices = shipMesh;
     shipModel.uniforms = shipUniform;
     shipModel.shader = Shader::Ship;
+    shipModel.bounds = shipBounds;
+    shipModel.pass = DrawPass::Foreground;
 
     // ##################################### Sun #####################################
     Uniforms sunUniform = planetBaseUniform(camera);
@@ -196,9 +684,12 @@ int main(int argc, char** argv) {
 
     // Create model
     Model sunModel;
-    sunModel.vertices = planetVBO;
+    sunModel.vertices = planetMesh;
     sunModel.uniforms = sunUniform;
     sunModel.shader = Shader::Sun;
+    sunModel.bounds = planetBounds;
+    sunModel.sphere = true;
+    sunModel.occluderRadius = planetInnerRadius;
 
     // ##################################### Earth #####################################
     Uniforms earthUniform = planetBaseUniform(camera);
@@ -209,9 +700,12 @@ int main(int argc, char** argv) {
 
     // Create model
     Model earthModel;
-    earthModel.vertices = planetVBO;
+    earthModel.vertices = planetMesh;
     earthModel.uniforms = earthUniform;
     earthModel.shader = Shader::Earth;
+    earthModel.bounds = planetBounds;
+    earthModel.sphere = true;
+    earthModel.occluderRadius = planetInnerRadius;
 
     // ##################################### Jupiter #####################################
     Uniforms jupiterUniform = planetBaseUniform(camera);
@@ -222,9 +716,12 @@ int main(int argc, char** argv) {
 
     // Create model
     Model jupiterModel;
-    jupiterModel.vertices = planetVBO;
+    jupiterModel.vertices = planetMesh;
     jupiterModel.uniforms = jupiterUniform;
     jupiterModel.shader = Shader::Jupiter;
+    jupiterModel.bounds = planetBounds;
+    jupiterModel.sphere = true;
+    jupiterModel.occluderRadius = planetInnerRadius;
 
     // ##################################### Uranus #####################################
     Uniforms uranusUniform = planetBaseUniform(camera);
@@ -235,9 +732,12 @@ int main(int argc, char** argv) {
 
     // Create model
     Model uranusModel;
-    uranusModel.vertices = planetVBO;
+    uranusModel.vertices = planetMesh;
     uranusModel.uniforms = uranusUniform;
     uranusModel.shader = Shader::Uranus;
+    uranusModel.bounds = planetBounds;
+    uranusModel.sphere = true;
+    uranusModel.occluderRadius = planetInnerRadius;
 
     // ##################################### Mars #####################################
     Uniforms marsUniform = planetBaseUniform(camera);
@@ -248,46 +748,75 @@ int main(int argc, char** argv) {
 
     // Create model
     Model marsModel;
-    marsModel.vertices = planetVBO;
+    marsModel.vertices = planetMesh;
     marsModel.uniforms = marsUniform;
     marsModel.shader = Shader::Mars;
+    marsModel.bounds = planetBounds;
+    marsModel.sphere = true;
+    marsModel.occluderRadius = planetInnerRadius;
 
 
 
+    // Hilo de render: dibuja en un framebuffer libre mientras este hilo presenta el ultimo frame
+    // terminado y prepara el siguiente
+    BufferRing framebufferRing(FRAMEBUFFER_COUNT);
+    FramePipeline<FrameState> pipeline([&framebufferRing](const FrameState& frame) {
+        int target = framebufferRing.acquireFree();
+        framebuffer = &framebuffers[target];
+        render(frame);
+        framebufferRing.markReady(target);
+    });
+
     cout << "Starting loop" << endl;
 
     bool running = true;
-    bool orbiting = true;
+    bool paused = false;
+    int statsFrames = 0;
 
     float rotationSpeedPlanets = 1.0f;  // Base speed of the planets
     float orbitSpeedPlanets = 1.0f;  // Base speed of the planets
 
-    float rotationAngleSun = 0.2f;
-
-    float earthOrbitAngle = 0.0f;
     float earthDistanceToSun = 3.5f;
-    float rotationAngleEarth = 0.0f;
-
-    float marsOrbitAngle = 0.0f;
     float marsDistanceToSun = 5.0f;
-    float rotationAngleMars = 0.0f;
-
-    float jupiterOrbitAngle = 0.0f;
     float jupiterDistanceToSun = 6.5f;
-    float rotationAngleJupiter = 0.0f;
-
-    float uranusOrbitAngle = 0.0f;
     float uranusDistanceToSun = 8.0f;
-    float rotationAngleUranus = 0.0f;
+
+    // La simulacion avanza en pasos fijos; cada frame dibuja un punto entre los dos ultimos pasos
+    SolarSystemState previousState;
+    SolarSystemState currentState;
+    SimulationClock simulationClock;
+
+    // Frames sin cambios: no se vuelven a dibujar, y idleMeter mide el CPU que eso ahorra
+    FrameInputs lastInputs;
+    bool haveLastInputs = false;
+    bool exposed = false;
+    long skippedFrames = 0;
+    long idleWakeups = 0;
+    IdleMeter idleMeter;
+
+    // --lockstep: un paso por frame, mismos estados a cualquier velocidad
+    // --uncapped: sin limite de frames, junto con --lockstep corre mas rapido que el tiempo real
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--lockstep") {
+            simulationClock.lockstep = true;
+        } else if (arg == "--uncapped") {
+            pacer.mode = PacingMode::Uncapped;
+        }
+    }
 
     while (running) {
-        frameStart = SDL_GetTicks();
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) {
                 running = false;
             }
 
+            // La ventana se tapo o cambio: hay que volver a mostrar el frame aunque no cambie
+            if (event.type == SDL_WINDOWEVENT) {
+                exposed = true;
+            }
+
             if (event.type == SDL_KEYDOWN) {
                 float increment = 0.5f;
                 switch (event.key.keysym.sym) {
@@ -335,7 +864,52 @@ int main(int argc, char** argv) {
 
                         break;
                     case SDLK_SPACE:
-                        orbiting = !orbiting;
+                        paused = !paused;
+                        break;
+                    case SDLK_q:
+                        noiseQuality = (noiseQuality == NoiseQuality::Exact) ? NoiseQuality::Cached : NoiseQuality::Exact;
+                        std::cout << "noise: " << (noiseQuality == NoiseQuality::Exact ? "exact" : "cached") << std::endl;
+                        break;
+                    case SDLK_m:
+                        switch (renderMode) {
+                            case RenderMode::ZBuffer:
+                                renderMode = RenderMode::Atomic;
+                                std::cout << "render mode: atomic" << std::endl;
+                                break;
+                            case RenderMode::Atomic:
+                                renderMode = RenderMode::SortLast;
+                                std::cout << "render mode: sort-last" << std::endl;
+                                break;
+                            case RenderMode::SortLast:
+                                renderMode = RenderMode::Binned;
+                                std::cout << "render mode: binned" << std::endl;
+                                break;
+                            case RenderMode::Binned:
+                                renderMode = RenderMode::ZBuffer;
+                                std::cout << "render mode: z-buffer" << std::endl;
+                                break;
+                        }
+                        break;
+                    case SDLK_p:
+                        painterMode = !painterMode;
+                        std::cout << "painter mode: " << (painterMode ? "on" : "off") << std::endl;
+                        break;
+                    case SDLK_v:
+                        switch (pacer.mode) {
+                            case PacingMode::Capped:
+                                pacer.mode = PacingMode::Uncapped;
+                                std::cout << "pacing: uncapped" << std::endl;
+                                break;
+                            case PacingMode::Uncapped:
+                                pacer.mode = PacingMode::VSync;
+                                std::cout << "pacing: vsync" << std::endl;
+                                break;
+                            case PacingMode::VSync:
+                                pacer.mode = PacingMode::Capped;
+                                std::cout << "pacing: 60 fps" << std::endl;
+                                break;
+                        }
+                        SDL_RenderSetVSync(renderer, pacer.mode == PacingMode::VSync ? 1 : 0);
                         break;
                 }
             }
@@ -343,19 +917,68 @@ int main(int argc, char** argv) {
 
         // ##################################### Rotations #####################################
 
-        rotationAngleSun += rotationSpeedPlanets * 0.2f;
-        rotationAngleEarth += rotationSpeedPlanets * 0.8f;
-        rotationAngleMars += rotationSpeedPlanets * 0.6f;
-        rotationAngleJupiter += rotationSpeedPlanets * 0.4f;
-        rotationAngleUranus += rotationSpeedPlanets * 0.3f;
-
-        // ##################################### Orbits #####################################
-        if(orbiting) {
-            earthOrbitAngle += 1.0f * orbitSpeedPlanets;
-            marsOrbitAngle += 0.8f * orbitSpeedPlanets;
-            jupiterOrbitAngle += 0.6f * orbitSpeedPlanets;
-            uranusOrbitAngle += 0.4f * orbitSpeedPlanets;
+        // Rotations and orbits advance in fixed steps, independent of the frame rate. Paused, the
+        // whole scene stays still
+        int steps = simulationClock.advance();
+        if (paused) {
+            previousState = currentState;
+            steps = 0;
+        }
+        for (; steps > 0; --steps) {
+            previousState = currentState;
+            currentState = stepSimulation(currentState, rotationSpeedPlanets, orbitSpeedPlanets);
+        }
+        SolarSystemState scene = interpolate(previousState, currentState, simulationClock.alpha());
+
+        // ##################################### Idle #####################################
+        // Nada cambio desde el ultimo frame dibujado: se termina de mostrar ese frame y no se
+        // dibuja otra vez la misma imagen. Si la escena tampoco puede moverse sola (pausada o sin
+        // velocidad) se duerme hasta el siguiente evento
+        FrameInputs inputs{camera, scene, renderMode, painterMode, noiseQuality};
+        if (running && haveLastInputs && sameInputs(inputs, lastInputs)) {
+            bool animating = !paused && (rotationSpeedPlanets != 0.0f || orbitSpeedPlanets != 0.0f);
+            pipeline.waitRendered();
+            int shown;
+            if (framebufferRing.takeReady(shown)) {
+                present(framebuffers[shown]);
+                framebufferRing.release(shown);
+                pacer.wait();
+            } else if (animating) {
+                // Todavia no toca el siguiente paso de la simulacion
+                pacer.wait();
+            } else {
+                if (!idleMeter.idle()) {
+                    idleMeter.enter();
+                }
+                if (exposed) {
+                    presentAgain();
+                }
+                SDL_WaitEvent(nullptr);
+                ++idleWakeups;
+                // El tiempo dormido no avanza la simulacion de golpe al despertar
+                simulationClock.skip();
+            }
+            exposed = false;
+            ++skippedFrames;
+            continue;
         }
+        if (idleMeter.idle()) {
+            IdleMeter::Report idle = idleMeter.leave();
+            std::cout << "Idle: " << idle.seconds << " s, " << skippedFrames << " frames skipped, " << idleWakeups
+                      << " wakeups, " << idle.cpuSeconds * 1000.0 << " ms CPU used vs " << idle.activeCpuSeconds * 1000.0
+                      << " ms at the active rate (" << (idle.activeCpuSeconds - idle.cpuSeconds) * 1000.0
+                      << " ms saved)" << std::endl;
+            idleWakeups = 0;
+        }
+        skippedFrames = 0;
+        lastInputs = inputs;
+        haveLastInputs = true;
+        exposed = false;
+
+        // Copia del estado que nadie mas esta leyendo
+        FrameState& frame = pipeline.next();
+        std::vector<Model>& models = frame.models;
+        models.clear();
 
         // ##################################### Ship #####################################
         shipUniform.model = createShipModelMatrix(shipTranslationVector, shipScaleFactor);
@@ -363,7 +986,7 @@ int main(int argc, char** argv) {
 
 
         // ##################################### Sun #####################################
-        sunUniform.model = createModelMatrix(sunTranslationVector, sunScaleFactor, sunRotationAxis, rotationAngleSun);
+        sunUniform.model = createModelMatrix(sunTranslationVector, sunScaleFactor, sunRotationAxis, scene.rotationSun);
         sunModel.modelMatrix = sunUniform.model;
 
         models.push_back(sunModel);
@@ -372,11 +995,11 @@ int main(int argc, char** argv) {
         // move the planet around the sun on the x and y axis
 
         glm::vec3 earthTranslationVector(
-                earthDistanceToSun * cos(glm::radians(earthOrbitAngle)),
+                earthDistanceToSun * cos(glm::radians(scene.orbitEarth)),
                 0.0f,
-                earthDistanceToSun * sin(glm::radians(earthOrbitAngle))
+                earthDistanceToSun * sin(glm::radians(scene.orbitEarth))
         );
-        earthUniform.model = createModelMatrix(earthTranslationVector, earthScaleFactor, earthRotationAxis, rotationAngleEarth);
+        earthUniform.model = createModelMatrix(earthTranslationVector, earthScaleFactor, earthRotationAxis, scene.rotationEarth);
         earthModel.modelMatrix = earthUniform.model;
 
         models.push_back(earthModel);
@@ -385,11 +1008,11 @@ int main(int argc, char** argv) {
         // move the planet around the sun on the x and y axis
 
         glm::vec3 marsTranslationVector(
-                marsDistanceToSun * cos(glm::radians(marsOrbitAngle)),
+                marsDistanceToSun * cos(glm::radians(scene.orbitMars)),
                 0.0f,
-                marsDistanceToSun * sin(glm::radians(marsOrbitAngle))
+                marsDistanceToSun * sin(glm::radians(scene.orbitMars))
         );
-        marsUniform.model = createModelMatrix(marsTranslationVector, marsScaleFactor, marsRotationAxis, rotationAngleMars);
+        marsUniform.model = createModelMatrix(marsTranslationVector, marsScaleFactor, marsRotationAxis, scene.rotationMars);
         marsModel.modelMatrix = marsUniform.model;
 
         models.push_back(marsModel);
@@ -398,11 +1021,11 @@ int main(int argc, char** argv) {
         // move the planet around the sun on the x and y axis
 
         glm::vec3 jupiterTranslationVector(
-                jupiterDistanceToSun * cos(glm::radians(jupiterOrbitAngle)),
+                jupiterDistanceToSun * cos(glm::radians(scene.orbitJupiter)),
                 0.0f,
-                jupiterDistanceToSun * sin(glm::radians(jupiterOrbitAngle))
+                jupiterDistanceToSun * sin(glm::radians(scene.orbitJupiter))
         );
-        jupiterUniform.model = createModelMatrix(jupiterTranslationVector, jupiterScaleFactor, jupiterRotationAxis, rotationAngleJupiter);
+        jupiterUniform.model = createModelMatrix(jupiterTranslationVector, jupiterScaleFactor, jupiterRotationAxis, scene.rotationJupiter);
         jupiterModel.modelMatrix = jupiterUniform.model;
 
         models.push_back(jupiterModel);
@@ -411,43 +1034,74 @@ int main(int argc, char** argv) {
         // move the planet around the sun on the x and y axis
 
         glm::vec3 uranusTranslationVector(
-                uranusDistanceToSun * cos(glm::radians(uranusOrbitAngle)),
+                uranusDistanceToSun * cos(glm::radians(scene.orbitUranus)),
                 0.0f,
-                uranusDistanceToSun * sin(glm::radians(uranusOrbitAngle))
+                uranusDistanceToSun * sin(glm::radians(scene.orbitUranus))
         );
-        uranusUniform.model = createModelMatrix(uranusTranslationVector, uranusScaleFactor, uranusRotationAxis, rotationAngleUranus);
+        uranusUniform.model = createModelMatrix(uranusTranslationVector, uranusScaleFactor, uranusRotationAxis, scene.rotationUranus);
         uranusModel.modelMatrix = uranusUniform.model;
 
         models.push_back(uranusModel);
 
 
         // ##################################### Render #####################################
-        clear();
-
-        models = updateCamera(models, camera);
+        updateCamera(models, camera);
 
         models.push_back(shipModel);
 
-        render();
+        frame.view = createViewMatrix(camera);
+        frame.projection = createProjectionMatrix();
+        frame.renderMode = renderMode;
+        frame.painterMode = painterMode;
+        frame.noiseQuality = noiseQuality;
+
+        sortModels(models, frame.view);
+        cullOccluded(models, frame.view);
+        vertexStage(frame);
+
+        // En lockstep el frame anterior termina de dibujarse antes de entregar este, asi cada
+        // frame se presenta en orden y el resultado se repite. Si no, el render sigue con lo que
+        // tenga mientras aqui se presenta lo ultimo que termino
+        if (simulationClock.lockstep) {
+            pipeline.waitRendered();
+        }
 
-        models.clear();
+        // Cada ~2 segundos, cuanto trabajo se ahorraron la oclusion y el z jerarquico, y cuanto
+        // espero el render por un framebuffer libre (con el render quieto)
+        if (++statsFrames == 120) {
+            pipeline.waitRendered();
+            printRasterStats(statsFrames);
+            jobSystem().printStats();
+            jobSystem().resetStats();
+            BufferRing::Stats ring = framebufferRing.takeStats();
+            std::cout << "Framebuffers (" << FRAMEBUFFER_COUNT << "): render waited " << ring.waits << " times, "
+                      << ring.waitSeconds * 1000.0 << " ms" << std::endl;
+            statsFrames = 0;
+        }
 
-        // Present the frame buffer to the screen
-        SDL_RenderPresent(renderer);
+        pipeline.submit();
 
-        // Delay to limit the frame rate
-        SDL_Delay(1000 / 60);
+        // Present the frame buffer to the screen
+        int shown;
+        if (framebufferRing.takeReady(shown)) {
+            present(framebuffers[shown]);
+            framebufferRing.release(shown);
+        }
 
-        frameTime = SDL_GetTicks() - frameStart;
+        // Limit the frame rate
+        pacer.wait();
 
         // Calculate frames per second and update window title
-        if (frameTime > 0) {
+        if (pacer.lastFrameSeconds() > 0.0) {
             std::ostringstream titleStream;
-            titleStream << planet + " FPS: " << 1000.0 / frameTime;  // Milliseconds to seconds
+            titleStream << planet + " FPS: " << 1.0 / pacer.lastFrameSeconds();
             SDL_SetWindowTitle(window, titleStream.str().c_str());
         }
     }
 
+    pipeline.waitRendered();
+
+    SDL_DestroyTexture(texture);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
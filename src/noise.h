@@ -1,12 +1,291 @@
 #pragma once
 #include "./FastNoise.h"
 #include <vector>
+#include <algorithm>
+#include "jobs.h"
+#include <cmath>
+#include <iostream>
 
 constexpr int NOISE_WIDTH = 512;
 constexpr int NOISE_HEIGHT = 512;
+constexpr int NOISE_DEPTH = 32;
 
-FastNoiseLite noise;
+// Distancia en coordenadas de ruido entre texels de la cache; el ruido base (frecuencia 0.01)
+// tiene rasgos de ~100 unidades, asi quedan ~12 texels por rasgo
+constexpr float NOISE_TEXEL = 8.0f;
+
+// Configuraciones fijas de los shaders, resueltas en compilacion (sin dispatch por llamada).
+// Son const y GetNoiseBatch no guarda estado, asi que todos los hilos pueden usarlas a la vez
+// sin copias por hilo ni sincronizacion
+struct SimplexNoise : FastNoiseSettings {
+    static constexpr FastNoiseLite::NoiseType noiseType = FastNoiseLite::NoiseType_OpenSimplex2;
+};
+
+struct CellularNoise : FastNoiseSettings {
+    static constexpr FastNoiseLite::NoiseType noiseType = FastNoiseLite::NoiseType_Cellular;
+};
+
+const FastNoiseStatic<SimplexNoise> simplexNoise;
+const FastNoiseStatic<CellularNoise> cellularNoise;
+
+// Exact evalua el ruido en cada muestra; Cached lee la textura precalculada (mas rapido, algo
+// mas suave y periodica cada NOISE_WIDTH * NOISE_TEXEL unidades). Viaja con el estado de cada
+// frame, asi cambiarla no afecta a un frame que ya se esta dibujando
+enum class NoiseQuality {
+    Exact,
+    Cached,
+};
+
+// Peso del texel "envuelto" cerca del borde de un periodo: 0 en casi todo el tile y sube
+// suavemente a 1 en la ultima franja, donde el valor se mezcla con el del inicio del tile
+inline float tileBlend(int i, int size) {
+    const int band = size / 8;
+    float t = float(i - (size - band)) / band;
+    t = std::clamp(t, 0.0f, 1.0f);
+    return t * t * (3.0f - 2.0f * t);
+}
+
+inline float lerp(float a, float b, float t) {
+    return a + t * (b - a);
+}
+
+// Ruido 2D precalculado sobre un periodo de NOISE_WIDTH x NOISE_HEIGHT texels, repetible sin costuras
+struct NoiseTexture2D {
+    static constexpr int W = NOISE_WIDTH;
+    static constexpr int H = NOISE_HEIGHT;
+    static_assert((W & (W - 1)) == 0 && (H & (H - 1)) == 0, "El tamano de la textura debe ser potencia de 2");
+
+    std::vector<float> texels = std::vector<float>(W * H);
+
+    template <typename Settings>
+    explicit NoiseTexture2D(const FastNoiseStatic<Settings>& generator) {
+        const float periodX = W * NOISE_TEXEL;
+        const float periodY = H * NOISE_TEXEL;
+
+        parallelFor(0, H, 1, [&](int j) {
+            float xs[W], ys[W], shiftedXs[W], shiftedYs[W];
+            float base[W], wrapX[W], wrapY[W], wrapXY[W];
+            for (int i = 0; i < W; ++i) {
+                xs[i] = i * NOISE_TEXEL;
+                ys[i] = j * NOISE_TEXEL;
+                shiftedXs[i] = xs[i] - periodX;
+                shiftedYs[i] = ys[i] - periodY;
+            }
+
+            // Solo la franja del borde necesita las copias desplazadas un periodo
+            const int band = W - W / 8;
+            float wy = tileBlend(j, H);
+            generator.GetNoiseBatch(xs, ys, base, W);
+            generator.GetNoiseBatch(shiftedXs + band, ys + band, wrapX + band, W - band);
+            if (wy > 0.0f) {
+                generator.GetNoiseBatch(xs, shiftedYs, wrapY, W);
+                generator.GetNoiseBatch(shiftedXs + band, shiftedYs + band, wrapXY + band, W - band);
+            }
+
+            float* row = &texels[j * W];
+            for (int i = 0; i < W; ++i) {
+                float wx = tileBlend(i, W);
+                float value = (wx > 0.0f) ? lerp(base[i], wrapX[i], wx) : base[i];
+                if (wy > 0.0f) {
+                    float wrapped = (wx > 0.0f) ? lerp(wrapY[i], wrapXY[i], wx) : wrapY[i];
+                    value = lerp(value, wrapped, wy);
+                }
+                row[i] = value;
+            }
+        });
+    }
+
+    float texel(int i, int j) const {
+        return texels[(j & (H - 1)) * W + (i & (W - 1))];
+    }
+
+    // Interpolacion bilineal en coordenadas de ruido
+    float sample(float x, float y) const {
+        float u = x * (1.0f / NOISE_TEXEL);
+        float v = y * (1.0f / NOISE_TEXEL);
+        float fu = std::floor(u);
+        float fv = std::floor(v);
+        int i = (int)fu;
+        int j = (int)fv;
+        float tu = u - fu;
+        float tv = v - fv;
+        return lerp(lerp(texel(i, j), texel(i + 1, j), tu),
+                    lerp(texel(i, j + 1), texel(i + 1, j + 1), tu), tv);
+    }
+
+    void sampleBatch(const float* xs, const float* ys, float* out, int n) const {
+        int k = 0;
+#if defined(FNL_SIMD)
+        using namespace FNLSimd;
+        for (; k + Width <= n; k += Width) {
+            Float u = Load(xs + k) * (1.0f / NOISE_TEXEL);
+            Float v = Load(ys + k) * (1.0f / NOISE_TEXEL);
+            Int i = Truncate(u) + MaskToInt(u < 0.0f); // floor
+            Int j = Truncate(v) + MaskToInt(v < 0.0f);
+            Float tu = u - Convert(i);
+            Float tv = v - Convert(j);
+
+            Int i0 = i & (W - 1);
+            Int i1 = (i + 1) & (W - 1);
+            Int j0 = (j & (H - 1)) * W;
+            Int j1 = ((j + 1) & (H - 1)) * W;
+
+            const float* t = texels.data();
+            Float top = Gather(t, j0 + i0);
+            top = top + tu * (Gather(t, j0 + i1) - top);
+            Float bottom = Gather(t, j1 + i0);
+            bottom = bottom + tu * (Gather(t, j1 + i1) - bottom);
+            Store(out + k, top + tv * (bottom - top));
+        }
+#endif
+        for (; k < n; ++k) {
+            out[k] = sample(xs[k], ys[k]);
+        }
+    }
+};
+
+// Ruido 3D precalculado; el periodo en z es corto (NOISE_DEPTH texels) porque los shaders
+// solo recorren un rango pequeno en esa coordenada
+struct NoiseTexture3D {
+    static constexpr int W = NOISE_WIDTH / 4;
+    static constexpr int H = NOISE_HEIGHT / 4;
+    static constexpr int D = NOISE_DEPTH;
+    static_assert((W & (W - 1)) == 0 && (H & (H - 1)) == 0 && (D & (D - 1)) == 0, "El tamano de la textura debe ser potencia de 2");
+
+    std::vector<float> texels = std::vector<float>(W * H * D);
+
+    template <typename Settings>
+    explicit NoiseTexture3D(const FastNoiseStatic<Settings>& generator) {
+        const float period[3] = { W * NOISE_TEXEL, H * NOISE_TEXEL, D * NOISE_TEXEL };
+
+        parallelFor(0, H * D, 1, [&](int row) {
+            int j = row % H;
+            int l = row / H;
+            float wy = tileBlend(j, H);
+            float wz = tileBlend(l, D);
+
+            float xs[W], ys[W], zs[W], wrapped[W];
+            float* out = &texels[row * W];
+            std::fill(out, out + W, 0.0f);
+
+            // Suma ponderada de las 8 copias desplazadas, saltando las de peso 0
+            for (int corner = 0; corner < 8; ++corner) {
+                bool sx = corner & 1, sy = corner & 2, sz = corner & 4;
+                float wyz = (sy ? wy : 1.0f - wy) * (sz ? wz : 1.0f - wz);
+                if (wyz <= 0.0f) {
+                    continue;
+                }
+                for (int i = 0; i < W; ++i) {
+                    xs[i] = i * NOISE_TEXEL - (sx ? period[0] : 0.0f);
+                    ys[i] = j * NOISE_TEXEL - (sy ? period[1] : 0.0f);
+                    zs[i] = l * NOISE_TEXEL - (sz ? period[2] : 0.0f);
+                }
+                const int first = sx ? W - W / 8 : 0;
+                generator.GetNoiseBatch(xs + first, ys + first, zs + first, wrapped + first, W - first);
+                for (int i = first; i < W; ++i) {
+                    float wx = tileBlend(i, W);
+                    out[i] += wrapped[i] * (sx ? wx : 1.0f - wx) * wyz;
+                }
+            }
+        });
+    }
+
+    float texel(int i, int j, int l) const {
+        return texels[((l & (D - 1)) * H + (j & (H - 1))) * W + (i & (W - 1))];
+    }
+
+    // Interpolacion trilineal en coordenadas de ruido
+    float sample(float x, float y, float z) const {
+        float u = x * (1.0f / NOISE_TEXEL);
+        float v = y * (1.0f / NOISE_TEXEL);
+        float w = z * (1.0f / NOISE_TEXEL);
+        float fu = std::floor(u), fv = std::floor(v), fw = std::floor(w);
+        int i = (int)fu, j = (int)fv, l = (int)fw;
+        float tu = u - fu, tv = v - fv, tw = w - fw;
+        float front = lerp(lerp(texel(i, j, l), texel(i + 1, j, l), tu),
+                           lerp(texel(i, j + 1, l), texel(i + 1, j + 1, l), tu), tv);
+        float back = lerp(lerp(texel(i, j, l + 1), texel(i + 1, j, l + 1), tu),
+                          lerp(texel(i, j + 1, l + 1), texel(i + 1, j + 1, l + 1), tu), tv);
+        return lerp(front, back, tw);
+    }
+
+    void sampleBatch(const float* xs, const float* ys, const float* zs, float* out, int n) const {
+        int k = 0;
+#if defined(FNL_SIMD)
+        using namespace FNLSimd;
+        for (; k + Width <= n; k += Width) {
+            Float u = Load(xs + k) * (1.0f / NOISE_TEXEL);
+            Float v = Load(ys + k) * (1.0f / NOISE_TEXEL);
+            Float w = Load(zs + k) * (1.0f / NOISE_TEXEL);
+            Int i = Truncate(u) + MaskToInt(u < 0.0f); // floor
+            Int j = Truncate(v) + MaskToInt(v < 0.0f);
+            Int l = Truncate(w) + MaskToInt(w < 0.0f);
+            Float tu = u - Convert(i);
+            Float tv = v - Convert(j);
+            Float tw = w - Convert(l);
+
+            Int i0 = i & (W - 1);
+            Int i1 = (i + 1) & (W - 1);
+            Int j0 = (j & (H - 1)) * W;
+            Int j1 = ((j + 1) & (H - 1)) * W;
+            Int l0 = (l & (D - 1)) * (W * H);
+            Int l1 = ((l + 1) & (D - 1)) * (W * H);
+
+            const float* t = texels.data();
+            auto bilinear = [&](Int slice) {
+                Float top = Gather(t, slice + j0 + i0);
+                top = top + tu * (Gather(t, slice + j0 + i1) - top);
+                Float bottom = Gather(t, slice + j1 + i0);
+                bottom = bottom + tu * (Gather(t, slice + j1 + i1) - bottom);
+                return top + tv * (bottom - top);
+            };
+            Float front = bilinear(l0);
+            Float back = bilinear(l1);
+            Store(out + k, front + tw * (back - front));
+        }
+#endif
+        for (; k < n; ++k) {
+            out[k] = sample(xs[k], ys[k], zs[k]);
+        }
+    }
+};
+
+// Una textura por configuracion de ruido, generada la primera vez que se pide
+template <typename Settings>
+const NoiseTexture2D& noiseTexture2D(const FastNoiseStatic<Settings>& generator) {
+    static const NoiseTexture2D texture(generator);
+    return texture;
+}
+
+template <typename Settings>
+const NoiseTexture3D& noiseTexture3D(const FastNoiseStatic<Settings>& generator) {
+    static const NoiseTexture3D texture(generator);
+    return texture;
+}
+
+// Ruido en n puntos, exacto o leido de la cache segun quality
+template <typename Settings>
+void noiseBatch(NoiseQuality quality, const FastNoiseStatic<Settings>& generator, const float* xs, const float* ys, float* out, int n) {
+    if (quality == NoiseQuality::Cached) {
+        noiseTexture2D(generator).sampleBatch(xs, ys, out, n);
+    } else {
+        generator.GetNoiseBatch(xs, ys, out, n);
+    }
+}
+
+template <typename Settings>
+void noiseBatch(NoiseQuality quality, const FastNoiseStatic<Settings>& generator, const float* xs, const float* ys, const float* zs, float* out, int n) {
+    if (quality == NoiseQuality::Cached) {
+        noiseTexture3D(generator).sampleBatch(xs, ys, zs, out, n);
+    } else {
+        generator.GetNoiseBatch(xs, ys, zs, out, n);
+    }
+}
 
 void setupNoise() {
-    noise.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2); // Set the noise type to Perlin
-}
\ No newline at end of file
+    // Genera de una vez las texturas que usan los shaders, para no trabar el primer frame
+    // cuando se cambia a NoiseQuality::Cached
+    noiseTexture2D(simplexNoise);
+    noiseTexture3D(simplexNoise);
+    noiseTexture2D(cellularNoise);
+}
@@ -3,6 +3,9 @@
 #include <vector>
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include "gl.h"
 
 enum class Shader {
@@ -17,14 +20,127 @@ enum class Shader {
     Ship,
 };
 
+// Varying each material reads; the vertex stage and the rasterizer carry nothing else
+Varying shaderVarying(Shader shader) {
+    switch (shader) {
+        case Shader::Ship:
+            return Varying::None;
+        default:
+            return Varying::OriginalPos;
+    }
+}
+
+// Esfera que envuelve todos los vertices de un modelo
+struct BoundingSphere {
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+};
+
+// Cuando se dibuja cada modelo dentro del frame
+enum class DrawPass {
+    Foreground,  // antes que todo: la nave, que casi siempre es lo mas cercano y tapa mucho
+    Opaque,      // ordenados de adelante hacia atras
+    Transparent, // al final, de atras hacia adelante
+};
+
 class Model {
 public:
     glm::mat4 modelMatrix;
-    std::vector<glm::vec3> vertices;
+    std::shared_ptr<const std::vector<glm::vec3>> vertices; // VBO: posicion, normal, textura
     Uniforms uniforms;
     Shader shader;
+    BoundingSphere bounds; // en espacio del modelo
+    DrawPass pass = DrawPass::Opaque;
+    bool sphere = false; // esfera cerrada y convexa: admite culling de caras traseras y modo pintor
+    float occluderRadius = 0.0f; // radio de una esfera centrada en bounds.center que el modelo llena; 0 si no tapa nada
 };
 
+// Esfera centrada en la caja envolvente de las posiciones de un VBO (posicion, normal, textura)
+BoundingSphere computeBounds(const std::vector<glm::vec3>& vertexBufferObject) {
+    BoundingSphere sphere;
+    if (vertexBufferObject.empty()) {
+        return sphere;
+    }
+
+    glm::vec3 minCorner = vertexBufferObject[0];
+    glm::vec3 maxCorner = vertexBufferObject[0];
+    for (size_t i = 0; i < vertexBufferObject.size(); i += 3) {
+        minCorner = glm::min(minCorner, vertexBufferObject[i]);
+        maxCorner = glm::max(maxCorner, vertexBufferObject[i]);
+    }
+
+    sphere.center = (minCorner + maxCorner) * 0.5f;
+    for (size_t i = 0; i < vertexBufferObject.size(); i += 3) {
+        sphere.radius = std::max(sphere.radius, glm::length(vertexBufferObject[i] - sphere.center));
+    }
+    return sphere;
+}
+
+// Radio de la esfera inscrita en un modelo cerrado y convexo: distancia minima del centro al
+// plano de cada triangulo. Al ser teselada, la esfera del OBJ queda un poco dentro de bounds
+float computeInnerRadius(const std::vector<glm::vec3>& vertexBufferObject, const glm::vec3& center) {
+    float radius = std::numeric_limits<float>::max();
+    for (size_t i = 0; i + 6 < vertexBufferObject.size(); i += 9) {
+        const glm::vec3& a = vertexBufferObject[i];
+        const glm::vec3& b = vertexBufferObject[i + 3];
+        const glm::vec3& c = vertexBufferObject[i + 6];
+        glm::vec3 normal = glm::cross(b - a, c - a);
+        float length = glm::length(normal);
+        if (length > 0.0f) {
+            radius = std::min(radius, std::abs(glm::dot(normal / length, a - center)));
+        }
+    }
+    return radius == std::numeric_limits<float>::max() ? 0.0f : radius;
+}
+
+// Esfera del modelo en espacio de vista; el radio se escala con el eje mas estirado
+BoundingSphere viewBounds(const Model& model, const glm::mat4& view) {
+    glm::mat4 modelView = view * model.modelMatrix;
+    float scale = std::max(std::max(glm::length(glm::vec3(modelView[0])), glm::length(glm::vec3(modelView[1]))),
+                           glm::length(glm::vec3(modelView[2])));
+
+    BoundingSphere sphere;
+    sphere.center = glm::vec3(modelView * glm::vec4(model.bounds.center, 1.0f));
+    sphere.radius = model.bounds.radius * scale;
+    return sphere;
+}
+
+// Esfera solida del modelo como oclusor en espacio de vista; el radio se escala con el eje mas corto
+BoundingSphere viewOccluder(const Model& model, const glm::mat4& view) {
+    glm::mat4 modelView = view * model.modelMatrix;
+    float scale = std::min(std::min(glm::length(glm::vec3(modelView[0])), glm::length(glm::vec3(modelView[1]))),
+                           glm::length(glm::vec3(modelView[2])));
+
+    BoundingSphere sphere;
+    sphere.center = glm::vec3(modelView * glm::vec4(model.bounds.center, 1.0f));
+    sphere.radius = model.occluderRadius * scale;
+    return sphere;
+}
+
+// Prueba analitica en espacio de vista (camara en el origen): la esfera occludee queda oculta
+// si cabe entera en el cono que proyecta el oclusor (su radio angular mas la separacion angular
+// no pasa del radio angular del oclusor) y su punto mas cercano esta a una distancia de al menos
+// la del centro del oclusor, que siempre queda detras de la cara visible del oclusor
+bool occludes(const BoundingSphere& occluder, const BoundingSphere& occludee) {
+    float occluderDistance = glm::length(occluder.center);
+    float occludeeDistance = glm::length(occludee.center);
+    if (occluder.radius <= 0.0f || occluderDistance <= occluder.radius || occludeeDistance <= occludee.radius) {
+        return false;
+    }
+    if (occludeeDistance - occludee.radius < occluderDistance) {
+        return false;
+    }
+
+    float occluderAngle = std::asin(occluder.radius / occluderDistance);
+    float occludeeAngle = std::asin(occludee.radius / occludeeDistance);
+    float cosSeparation = glm::dot(occluder.center, occludee.center) / (occluderDistance * occludeeDistance);
+    float separation = std::acos(std::clamp(cosSeparation, -1.0f, 1.0f));
+
+    // Margen para que el redondeo no oculte un borde visible
+    const float epsilon = 1e-4f;
+    return separation + occludeeAngle <= occluderAngle - epsilon;
+}
+
 
 bool loadOBJ(
         const std::string& path,
@@ -0,0 +1,141 @@
+// pacing.h
+#pragma once
+#include <chrono>
+#include <thread>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Como se espacian los frames
+enum class PacingMode {
+    Capped,   // un frame cada 1/targetFps segundos contra steady_clock
+    Uncapped, // sin esperas, para medir
+    VSync,    // el present espera el refresco de la pantalla; aqui no se espera nada
+};
+
+// Ritmo de frames con reloj monotono de alta resolucion. Cada frame tiene una fecha limite a un
+// periodo de la anterior; wait() duerme solo lo que falta y los ultimos instantes los pasa
+// girando, porque el sleep del sistema puede pasarse por mas de un milisegundo.
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FramePacer(double targetFps)
+        : period(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / targetFps))) {
+        deadline = Clock::now() + period;
+        lastFrame = Clock::now();
+    }
+
+    PacingMode mode = PacingMode::Capped;
+
+    // Al final de cada frame: espera su turno (en modo Capped) y mide cuanto duro el frame
+    void wait() {
+        if (mode == PacingMode::Capped) {
+            Clock::time_point now = Clock::now();
+            // Si el frame se atraso mas de un periodo no se intenta recuperar con frames seguidos
+            if (now > deadline + period) {
+                deadline = now;
+            }
+            if (deadline - now > SPIN) {
+                std::this_thread::sleep_for(deadline - now - SPIN);
+            }
+            while (Clock::now() < deadline) {
+            }
+            deadline += period;
+        } else {
+            deadline = Clock::now() + period;
+        }
+
+        Clock::time_point now = Clock::now();
+        frameSeconds = std::chrono::duration<double>(now - lastFrame).count();
+        lastFrame = now;
+    }
+
+    // Duracion real del ultimo frame, de wait() a wait()
+    double lastFrameSeconds() const { return frameSeconds; }
+
+private:
+    // Margen final que se espera girando en vez de dormir
+    static constexpr std::chrono::microseconds SPIN{1500};
+
+    Clock::duration period;
+    Clock::time_point deadline;
+    Clock::time_point lastFrame;
+    double frameSeconds = 0.0;
+};
+
+// Tiempo de CPU (usuario + sistema) de todos los hilos del proceso. No se usa std::clock():
+// en MSVC devuelve tiempo de pared desde que arranco el proceso
+inline double processCpuSeconds() {
+#if defined(_WIN32)
+    FILETIME creation, exit, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) {
+        return 0.0;
+    }
+    auto ticks = [](const FILETIME& time) {
+        return (unsigned long long)time.dwHighDateTime << 32 | time.dwLowDateTime;
+    };
+    return double(ticks(kernel) + ticks(user)) * 1e-7; // unidades de 100 ns
+#else
+    timespec time;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0) {
+        return 0.0;
+    }
+    return double(time.tv_sec) + double(time.tv_nsec) * 1e-9;
+#endif
+}
+
+// Mide lo que se ahorra al no dibujar frames repetidos. Al entrar en reposo guarda cuanto CPU
+// por segundo gasto el tramo activo anterior; al salir compara lo que se habria gastado a ese
+// ritmo con el CPU que de verdad se uso mientras tanto
+class IdleMeter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Report {
+        double seconds = 0.0;       // tiempo en reposo
+        double cpuSeconds = 0.0;    // CPU usado en reposo
+        double activeCpuSeconds = 0.0; // CPU que se habria usado al ritmo del tramo activo
+    };
+
+    bool idle() const { return idling; }
+
+    void enter() {
+        Clock::time_point now = Clock::now();
+        double cpu = processCpuSeconds();
+        double wall = std::chrono::duration<double>(now - markWall).count();
+        if (wall > 0.0) {
+            activeRate = (cpu - markCpu) / wall;
+        }
+        markWall = now;
+        markCpu = cpu;
+        idling = true;
+    }
+
+    Report leave() {
+        Clock::time_point now = Clock::now();
+        double cpu = processCpuSeconds();
+        Report report;
+        report.seconds = std::chrono::duration<double>(now - markWall).count();
+        report.cpuSeconds = cpu - markCpu;
+        report.activeCpuSeconds = activeRate * report.seconds;
+        markWall = now;
+        markCpu = cpu;
+        idling = false;
+        return report;
+    }
+
+private:
+    Clock::time_point markWall = Clock::now();
+    double markCpu = processCpuSeconds();
+    double activeRate = 0.0; // segundos de CPU por segundo
+    bool idling = false;
+};
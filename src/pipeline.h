@@ -0,0 +1,176 @@
+// pipeline.h
+#pragma once
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Bucle de frames en dos etapas. El hilo principal llena el estado del frame N+1 (eventos,
+// simulacion, etapa de vertices) mientras un hilo de render dibuja el frame N. Hay tres copias
+// del estado: la que llena el hilo principal, la entregada que el render aun no toma y la que el
+// render esta leyendo. submit() solo espera a que el render tome la anterior, no a que la
+// termine, asi el hilo principal puede presentar un frame mientras el render ya va por el
+// siguiente del siguiente; cuanto puede adelantarse lo limita BufferRing.
+template <typename State>
+class FramePipeline {
+public:
+    explicit FramePipeline(std::function<void(const State&)> render)
+        : renderFrame(std::move(render)), thread([this] { renderLoop(); }) {}
+
+    ~FramePipeline() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        changed.notify_all();
+        thread.join();
+    }
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+
+    // Estado que el hilo principal llena para el siguiente frame; el render nunca lo lee a la vez
+    State& next() { return slots[fillIndex]; }
+
+    // Espera a que el render termine todo lo que se le entrego; despues nadie escribe ningun
+    // framebuffer ni lee las estadisticas del raster
+    void waitRendered() {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this] { return queued < 0 && renderingIndex < 0; });
+    }
+
+    // Entrega next() al render y pasa a llenar una copia que nadie usa. Solo espera si el render
+    // todavia no tomo la entrega anterior
+    void submit() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this] { return queued < 0; });
+            queued = fillIndex;
+            for (int i = 0; i < int(slots.size()); ++i) {
+                if (i != queued && i != renderingIndex) {
+                    fillIndex = i;
+                    break;
+                }
+            }
+        }
+        changed.notify_all();
+    }
+
+private:
+    std::function<void(const State&)> renderFrame;
+    std::array<State, 3> slots;
+    int fillIndex = 0;
+    int queued = -1; // copia entregada que el render aun no toma
+    int renderingIndex = -1; // copia que el render esta dibujando
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::thread thread; // al final: arranca cuando todo lo demas ya esta construido
+
+    void renderLoop() {
+        while (true) {
+            int index;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [this] { return stopping || queued >= 0; });
+                if (stopping) {
+                    return;
+                }
+                index = queued;
+                queued = -1;
+                renderingIndex = index;
+            }
+            changed.notify_all();
+
+            renderFrame(slots[index]);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                renderingIndex = -1;
+            }
+            changed.notify_all();
+        }
+    }
+};
+
+// Indices de N buffers que rotan entre el render y el present: libre -> dibujando -> listo ->
+// presentando -> libre. Solo se guarda el frame listo mas nuevo: al marcar uno, el anterior que
+// nadie llego a presentar vuelve a estar libre. Con 2 buffers el render espera cada vez que
+// termina un frame mientras el otro se sube; con 3 siempre le queda uno
+class BufferRing {
+public:
+    // Veces y tiempo que el render espero un buffer libre
+    struct Stats {
+        long waits = 0;
+        double waitSeconds = 0.0;
+    };
+
+    explicit BufferRing(int count) {
+        for (int i = 0; i < count; ++i) {
+            free.push_back(i);
+        }
+    }
+
+    // Render: toma un buffer libre para dibujar el siguiente frame
+    int acquireFree() {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (free.empty()) {
+            auto start = std::chrono::steady_clock::now();
+            changed.wait(lock, [this] { return !free.empty(); });
+            ++stats.waits;
+            stats.waitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        int index = free.front();
+        free.pop_front();
+        return index;
+    }
+
+    // Render: el buffer tiene un frame completo y reemplaza al listo anterior
+    void markReady(int index) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (ready >= 0) {
+                free.push_back(ready);
+            }
+            ready = index;
+        }
+        changed.notify_all();
+    }
+
+    // Present: el frame listo mas nuevo, sin esperar
+    bool takeReady(int& index) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (ready < 0) {
+            return false;
+        }
+        index = ready;
+        ready = -1;
+        return true;
+    }
+
+    // Present: termino de subir el buffer, el render puede volver a usarlo
+    void release(int index) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            free.push_back(index);
+        }
+        changed.notify_all();
+    }
+
+    Stats takeStats() {
+        std::lock_guard<std::mutex> lock(mutex);
+        Stats taken = stats;
+        stats = Stats();
+        return taken;
+    }
+
+private:
+    std::deque<int> free;
+    int ready = -1;
+    Stats stats;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
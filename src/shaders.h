@@ -15,11 +15,12 @@
 const glm::vec3 white = glm::vec3(1.0f, 1.0f, 1.0f);  // 1, 1, 1: White
 const glm::vec3 black = glm::vec3(0.0f, 0.0f, 0.0f);  // 0, 0, 0: Black
 
-Vertex vertexShader(const Vertex& vertex, const Uniforms& uniforms) {
+template <Varying V>
+Vertex vertexShader(const glm::vec3& position, const glm::vec3& normal, const glm::vec3& tex, const Uniforms& uniforms) {
     // genera codigo para imprimir toda una matriz de glm::mat4
 
     // Apply transformations to the input vertex using the matrices from the uniforms
-    glm::vec4 clipSpaceVertex = uniforms.projection * uniforms.view * uniforms.model * glm::vec4(vertex.position, 1.0f);
+    glm::vec4 clipSpaceVertex = uniforms.projection * uniforms.view * uniforms.model * glm::vec4(position, 1.0f);
 
     // Perspective divide
     glm::vec3 ndcVertex = glm::vec3(clipSpaceVertex) / clipSpaceVertex.w;
@@ -28,153 +29,137 @@ Vertex vertexShader(const Vertex& vertex, const Uniforms& uniforms) {
     glm::vec4 screenVertex = uniforms.viewport * glm::vec4(ndcVertex, 1.0f);
 
     // Transform the normal
-    glm::vec3 transformedNormal = glm::mat3(uniforms.model) * vertex.normal;
+    glm::vec3 transformedNormal = glm::mat3(uniforms.model) * normal;
     transformedNormal = glm::normalize(transformedNormal);
 
-    glm::vec3 transformedWorldPosition = glm::vec3(uniforms.model * glm::vec4(vertex.position, 1.0f));
+    // Only the attribute the material reads is carried to the rasterizer
+    glm::vec3 varying;
+    if constexpr (V == Varying::OriginalPos) {
+        varying = position;
+    } else if constexpr (V == Varying::WorldPos) {
+        varying = glm::vec3(uniforms.model * glm::vec4(position, 1.0f));
+    } else if constexpr (V == Varying::Tex) {
+        varying = tex;
+    }
 
     // Return the transformed vertex as a vec3
     return Vertex{
             glm::vec3(screenVertex),
             transformedNormal,
-            vertex.tex,
-            transformedWorldPosition,
-            vertex.position
+            varying
     };
 }
 
-std::vector<std::vector<Vertex>> primitiveAssembly (
-    const std::vector<Vertex>& transformedVertices
-) {
-    // Assemble the transformed vertices into triangles
-    // Return a vector of triangles, where each triangle is a vector of 3 vertices (vec3)
-
-    std::vector<std::vector<Vertex>> groupedVertices;
-
-    for (int i = 0; i < transformedVertices.size(); i += 3) {
-        std::vector<Vertex> vertexGroup;
-        vertexGroup.push_back(transformedVertices[i]);
-        vertexGroup.push_back(transformedVertices[i+1]);
-        vertexGroup.push_back(transformedVertices[i+2]);
-
-        groupedVertices.push_back(vertexGroup);
+void fragmentShader(FragmentSpan& span) {
+    for (int i = 0; i < span.count; ++i) {
+        span.color[i] = Color(255, 255, 255) * span.intensity[i];
     }
-
-    return groupedVertices;
 }
 
-Fragment fragmentShader(Fragment fragment) {
-    fragment.color = fragment.color * fragment.intensity;
-    return fragment;
-}
-
-Fragment sunFragmentShader(Fragment& fragment) {
-    Color color;
-
+void sunFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     // 235 127 33
     glm::vec3 mainColor = glm::vec3(235.0f/255.0f, 127.0f/255.0f, 33.0f/255.0f);  // 235, 127, 33: Orange
     // 194 77 14
     glm::vec3 secondColor = glm::vec3(194.0f/255.0f, 77.0f/255.0f, 14.0f/255.0f);  // 194, 77, 14: Dark orange
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x, fragment.originalPos.y);
-
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-
     float ox = 3200.0f;
     float oy = 3000.0f;
     float z = 3000.0f;
 
-    float noiseValue = noiseGenerator.GetNoise((uv.x + ox) * z, (uv.y + oy) * z, fragment.originalPos.z);
-
-    glm::vec3 tempColor;
-
-    tempColor = glm::mix(secondColor, mainColor,glm::smoothstep(0.3f, 0.5f, abs(noiseValue)));
-//    tempColor = (abs(noiseValue) < 0.6f) ? mainColor : secondColor;
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + ox) * z;
+        noiseY[i] = (span.oy[i] + oy) * z;
+    }
 
-    color = Color(tempColor.x, tempColor.y, tempColor.z);
+    float noiseValue[SPAN_SIZE];
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, span.oz, noiseValue, span.count);
 
-    fragment.color = color * fragment.intensity;
+    for (int i = 0; i < span.count; ++i) {
+        glm::vec3 tempColor = glm::mix(secondColor, mainColor, glm::smoothstep(0.3f, 0.5f, abs(noiseValue[i])));
+//        tempColor = (abs(noiseValue[i]) < 0.6f) ? mainColor : secondColor;
 
-    return fragment;
+        span.color[i] = Color(tempColor.x, tempColor.y, tempColor.z) * span.intensity[i];
+    }
 }
 
-Fragment earthFragmentShader(Fragment& fragment) {
-    Color color;
-
+void earthFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     glm::vec3 forestColor = glm::vec3(0.44f, 0.51f, 0.33f);
     glm::vec3 dirtColor = glm::vec3(179/255.0f, 147/255.0f, 120/255.0f);
     glm::vec3 oceanColor = glm::vec3(0.12f, 0.38f, 0.57f);
     glm::vec3 cloudColor = glm::vec3(1.0f, 1.0f, 1.0f);
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x, fragment.originalPos.y);
-
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-
     float ox = 1200.0f;
     float oy = 3000.0f;
     float zoom = 200.0f;
 
-    float noiseValue = noiseGenerator.GetNoise((uv.x + ox) * zoom, (uv.y + oy) * zoom);
-
-    glm::vec3 tmpColor;
-
-    if (noiseValue < 0.05f) {
-        tmpColor = oceanColor;
-    } else {
-        tmpColor = glm::mix(forestColor, dirtColor, glm::smoothstep(0.15f, 0.96f, noiseValue));
-    }
-
     float oxc = 5500.0f;
     float oyc = 6900.0f;
     float zoomc = 300.0f;
 
-    float noiseValueC = noiseGenerator.GetNoise((uv.x + oxc) * zoomc, (uv.y + oyc) * zoomc);
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    float noiseValue[SPAN_SIZE];
+    float noiseValueC[SPAN_SIZE];
 
-    if (noiseValueC > 0.5f) {
-        tmpColor = cloudColor;
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + ox) * zoom;
+        noiseY[i] = (span.oy[i] + oy) * zoom;
     }
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, noiseValue, span.count);
 
-    color = Color(tmpColor.x, tmpColor.y, tmpColor.z);
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + oxc) * zoomc;
+        noiseY[i] = (span.oy[i] + oyc) * zoomc;
+    }
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, noiseValueC, span.count);
 
-    fragment.color = color * fragment.intensity;
+    for (int i = 0; i < span.count; ++i) {
+        glm::vec3 tmpColor;
 
-    return fragment;
-}
+        if (noiseValue[i] < 0.05f) {
+            tmpColor = oceanColor;
+        } else {
+            tmpColor = glm::mix(forestColor, dirtColor, glm::smoothstep(0.15f, 0.96f, noiseValue[i]));
+        }
+
+        if (noiseValueC[i] > 0.5f) {
+            tmpColor = cloudColor;
+        }
 
-Fragment moonFragmentShader(Fragment& fragment) {
-    Color color;
+        span.color[i] = Color(tmpColor.x, tmpColor.y, tmpColor.z) * span.intensity[i];
+    }
+}
 
+void moonFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     // 185 185 185
     glm::vec3 mainColor = glm::vec3(185.0f/255.0f, 185.0f/255.0f, 185.0f/255.0f);  // 185, 185, 185: Gray
     // 140 140 140
     glm::vec3 secondColor = glm::vec3(140.0f/255.0f, 140.0f/255.0f, 140.0f/255.0f);  // 140, 140, 140: Dark gray
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x, fragment.originalPos.y);
-
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-
     float ox = 2000.0f;
     float oy = 2000.0f;
     float z = 350.0f;
 
-    float noiseValue = noiseGenerator.GetNoise((uv.x + ox) * z, (uv.y + oy) * z);
-
-    glm::vec3 tmpColor;
-    tmpColor = (noiseValue < 0.4f) ? mainColor : secondColor;
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + ox) * z;
+        noiseY[i] = (span.oy[i] + oy) * z;
+    }
 
-    color = Color(tmpColor.x, tmpColor.y, tmpColor.z);
+    float noiseValue[SPAN_SIZE];
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, noiseValue, span.count);
 
-    fragment.color = color * fragment.intensity;
+    for (int i = 0; i < span.count; ++i) {
+        glm::vec3 tmpColor = (noiseValue[i] < 0.4f) ? mainColor : secondColor;
 
-    return fragment;
+        span.color[i] = Color(tmpColor.x, tmpColor.y, tmpColor.z) * span.intensity[i];
+    }
 }
 
-Fragment jupiterFragmentShader(Fragment& fragment){
-    Color color;
-
+void jupiterFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     // 214 181 144
     glm::vec3 mainColor = glm::vec3(214.0f/255.0f, 181.0f/255.0f, 144.0f/255.0f);  // 214, 181, 144: Light brown
     // white
@@ -184,56 +169,66 @@ Fragment jupiterFragmentShader(Fragment& fragment){
     // 204 131 92
     glm::vec3 fourthColor = glm::vec3(204.0f/255.0f, 131.0f/255.0f, 92.0f/255.0f);  // 204, 131, 92: Brown
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x * 2.0 - 1.0 , fragment.originalPos.y * 2.0 - 1.0);
-
     // Frecuencia y amplitud de las ondas en el planeta
     float frequency = 10.0; // Ajusta la frecuencia de las líneas
     float amplitude = 0.2; // Ajusta la amplitud de las líneas
 
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_Cellular);
-
     float offsetX = 1000.0f;
     float offsetY = 200.0f;
     float scale = 100.0f;
 
-    // Genera el valor de ruido
-    float noiseValue = noiseGenerator.GetNoise((uv.x + offsetX) * scale, (uv.y + offsetY) * scale);
-    noiseValue = (noiseValue + 1.0f) * 0.5f;
-    noiseValue = glm::smoothstep(0.2f, 0.8f, noiseValue);
-
-    glm::vec3 tmpColor;
-
-    // Interpola entre el color base y el color secundario basado en el valor de ruido
-    tmpColor = glm::mix(mainColor, secondColor, noiseValue);
-
-    // Calcula el valor sinusoide para crear líneas
-    float sinValue = glm::sin(uv.y * frequency) * amplitude;
-
-    // Combina el color base con las líneas sinusoide
-    tmpColor = glm::mix(tmpColor, thirdColor, sinValue);
-
     // Tormenta de Júpiter
     float oxc = 5500.0f;
     float oyc = 7300.0f;
     float zoomc = 80.0f;
 
-    float noiseValueC = noiseGenerator.GetNoise((uv.x + oxc) * zoomc, (uv.y + oyc) * zoomc);
+    float u[SPAN_SIZE];
+    float v[SPAN_SIZE];
+    for (int i = 0; i < span.count; ++i) {
+        u[i] = span.ox[i] * 2.0 - 1.0;
+        v[i] = span.oy[i] * 2.0 - 1.0;
+    }
 
-    if (abs(noiseValueC) > 0.985f) {
-        tmpColor = glm::mix(tmpColor, fourthColor, glm::smoothstep(0.985f, 1.0f, abs(noiseValueC)));
+    // Genera el valor de ruido
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    float noiseValue[SPAN_SIZE];
+    float noiseValueC[SPAN_SIZE];
+
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (u[i] + offsetX) * scale;
+        noiseY[i] = (v[i] + offsetY) * scale;
     }
+    noiseBatch(quality, cellularNoise, noiseX, noiseY, noiseValue, span.count);
 
-    color = Color(tmpColor.x, tmpColor.y, tmpColor.z);
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (u[i] + oxc) * zoomc;
+        noiseY[i] = (v[i] + oyc) * zoomc;
+    }
+    noiseBatch(quality, cellularNoise, noiseX, noiseY, noiseValueC, span.count);
 
-    fragment.color = color * fragment.intensity;
+    for (int i = 0; i < span.count; ++i) {
+        float noise = (noiseValue[i] + 1.0f) * 0.5f;
+        noise = glm::smoothstep(0.2f, 0.8f, noise);
 
-    return fragment;
-}
+        // Interpola entre el color base y el color secundario basado en el valor de ruido
+        glm::vec3 tmpColor = glm::mix(mainColor, secondColor, noise);
+
+        // Calcula el valor sinusoide para crear líneas
+        float sinValue = glm::sin(v[i] * frequency) * amplitude;
 
-Fragment uranusFragmentShader (Fragment& fragment){
-    Color color;
+        // Combina el color base con las líneas sinusoide
+        tmpColor = glm::mix(tmpColor, thirdColor, sinValue);
 
+        if (abs(noiseValueC[i]) > 0.985f) {
+            tmpColor = glm::mix(tmpColor, fourthColor, glm::smoothstep(0.985f, 1.0f, abs(noiseValueC[i])));
+        }
+
+        span.color[i] = Color(tmpColor.x, tmpColor.y, tmpColor.z) * span.intensity[i];
+    }
+}
+
+void uranusFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     // 173, 245, 247
     glm::vec3 mainColor = glm::vec3(173.0f/255.0f, 245.0f/255.0f, 247.0f/255.0f);  // 173, 245, 247: Light blue
     // 92, 171, 250
@@ -241,49 +236,56 @@ Fragment uranusFragmentShader (Fragment& fragment){
     // 14, 98, 181
     glm::vec3 thirdColor = glm::vec3(14.0f/255.0f, 98.0f/255.0f, 181.0f/255.0f);  // 14, 98, 181: Darker blue
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x * 2.0 - 1.0 , fragment.originalPos.y * 2.0 - 1.0);
-
     // Frecuencia y amplitud de las ondas en el planeta
     float frequency = 9.0; // Ajusta la frecuencia de las líneas
     float amplitude = 0.32; // Ajusta la amplitud de las líneas
 
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_Cellular);
-
     float offsetX = 1000.0f;
     float offsetY = 200.0f;
     float scale = 100.0f;
 
+    float u[SPAN_SIZE];
+    float v[SPAN_SIZE];
+    for (int i = 0; i < span.count; ++i) {
+        u[i] = span.ox[i] * 2.0 - 1.0;
+        v[i] = span.oy[i] * 2.0 - 1.0;
+    }
+
     // Genera el valor de ruido
-    float noiseValue = noiseGenerator.GetNoise((uv.x + offsetX) * scale, (uv.y + offsetY) * scale);
-    noiseValue = (noiseValue + 1.0f) * 0.5f;
-    noiseValue = glm::smoothstep(0.2f, 0.8f, noiseValue);
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (u[i] + offsetX) * scale;
+        noiseY[i] = (v[i] + offsetY) * scale;
+    }
 
-    glm::vec3 tmpColor;
+    float noiseValue[SPAN_SIZE];
+    noiseBatch(quality, cellularNoise, noiseX, noiseY, noiseValue, span.count);
 
-    // Interpola entre el color base y el color secundario basado en el valor de ruido
-    if (abs(noiseValue) < 0.8f) {
-        tmpColor = glm::mix(mainColor, secondColor, noiseValue);
-    } else {
-        tmpColor = glm::mix(secondColor, thirdColor, noiseValue);
-    }
+    for (int i = 0; i < span.count; ++i) {
+        float noise = (noiseValue[i] + 1.0f) * 0.5f;
+        noise = glm::smoothstep(0.2f, 0.8f, noise);
 
-    // Calcula el valor sinusoide para crear líneas
-    float sinValue = glm::sin(uv.y * frequency) * amplitude;
+        glm::vec3 tmpColor;
 
-    // Combina el color base con las líneas sinusoide
-    tmpColor = glm::mix(tmpColor, white, sinValue);
+        // Interpola entre el color base y el color secundario basado en el valor de ruido
+        if (abs(noise) < 0.8f) {
+            tmpColor = glm::mix(mainColor, secondColor, noise);
+        } else {
+            tmpColor = glm::mix(secondColor, thirdColor, noise);
+        }
 
-    color = Color(tmpColor.x, tmpColor.y, tmpColor.z);
+        // Calcula el valor sinusoide para crear líneas
+        float sinValue = glm::sin(v[i] * frequency) * amplitude;
 
-    fragment.color = color * fragment.intensity;
+        // Combina el color base con las líneas sinusoide
+        tmpColor = glm::mix(tmpColor, white, sinValue);
 
-    return fragment;
+        span.color[i] = Color(tmpColor.x, tmpColor.y, tmpColor.z) * span.intensity[i];
+    }
 }
 
-Fragment plutoFragmentShader(Fragment& fragment) {
-    Color color;
-
+void plutoFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     // 161 89 67
     glm::vec3 forestColor = glm::vec3(161.0f/255.0f, 89.0f/255.0f, 67.0f/255.0f);  // 161, 89, 67: Brown
     // 128 72 55
@@ -291,35 +293,34 @@ Fragment plutoFragmentShader(Fragment& fragment) {
     // 105 50 33
     glm::vec3 oceanColor = glm::vec3(105.0f/255.0f, 50.0f/255.0f, 33.0f/255.0f);  // 105, 50, 33: Darker brown
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x, fragment.originalPos.y);
-
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-
     float ox = 3000.0f;
     float oy = 1500.0f;
     float zoom = 150.0f;
 
-    float noiseValue = noiseGenerator.GetNoise((uv.x + ox) * zoom, (uv.y + oy) * zoom);
-
-    glm::vec3 tmpColor;
-
-    if (abs(noiseValue) < 0.4f) {
-        tmpColor = oceanColor;
-    } else {
-        tmpColor = glm::mix(forestColor, dirtColor, glm::smoothstep(0.15f, 0.96f, noiseValue));
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + ox) * zoom;
+        noiseY[i] = (span.oy[i] + oy) * zoom;
     }
 
-    color = Color(tmpColor.x, tmpColor.y, tmpColor.z);
+    float noiseValue[SPAN_SIZE];
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, noiseValue, span.count);
 
-    fragment.color = color * fragment.intensity;
+    for (int i = 0; i < span.count; ++i) {
+        glm::vec3 tmpColor;
 
-    return fragment;
-}
+        if (abs(noiseValue[i]) < 0.4f) {
+            tmpColor = oceanColor;
+        } else {
+            tmpColor = glm::mix(forestColor, dirtColor, glm::smoothstep(0.15f, 0.96f, noiseValue[i]));
+        }
 
-Fragment keplerFragmentShader(Fragment& fragment){
-    Color color;
+        span.color[i] = Color(tmpColor.x, tmpColor.y, tmpColor.z) * span.intensity[i];
+    }
+}
 
+void keplerFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     // 186 152 28
     glm::vec3 forestColor = glm::vec3(186.0f/255.0f, 152.0f/255.0f, 28.0f/255.0f);  // 186, 152, 28: Yellow
     // 148 121 22
@@ -328,71 +329,74 @@ Fragment keplerFragmentShader(Fragment& fragment){
     glm::vec3 oceanColor = glm::vec3(250.0f/255.0f, 228.0f/255.0f, 32.0f/255.0f);  // 250, 228, 32: Yellow
     glm::vec3 cloudColor = glm::vec3(1.0f, 1.0f, 1.0f);
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x, fragment.originalPos.y);
-
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
-
     float ox = 3200.0f;
     float oy = 2000.0f;
     float zoom = 200.0f;
 
-    float noiseValue = noiseGenerator.GetNoise((uv.x + ox) * zoom, (uv.y + oy) * zoom);
-
-    glm::vec3 tmpColor;
-
-    if (noiseValue < 0.05f) {
-        tmpColor = oceanColor;
-    } else {
-        tmpColor = glm::mix(forestColor, dirtColor, glm::smoothstep(0.15f, 0.96f, noiseValue));
-    }
-
     float oxc = 3500.0f;
     float oyc = 5000.0f;
     float zoomc = 300.0f;
 
-    float noiseValueC = noiseGenerator.GetNoise((uv.x + oxc) * zoomc, (uv.y + oyc) * zoomc);
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    float noiseValue[SPAN_SIZE];
+    float noiseValueC[SPAN_SIZE];
 
-    if (noiseValueC > 0.5f) {
-        tmpColor = cloudColor;
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + ox) * zoom;
+        noiseY[i] = (span.oy[i] + oy) * zoom;
     }
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, noiseValue, span.count);
 
-    color = Color(tmpColor.x, tmpColor.y, tmpColor.z);
-
-    fragment.color = color * fragment.intensity;
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + oxc) * zoomc;
+        noiseY[i] = (span.oy[i] + oyc) * zoomc;
+    }
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, noiseValueC, span.count);
 
-    return fragment;
-}
+    for (int i = 0; i < span.count; ++i) {
+        glm::vec3 tmpColor;
 
-// MAKE A SHADER TO DISPLAY PLAIN NOISE
-Fragment noiseFragmentShader(Fragment& fragment) {
-    Color color;
+        if (noiseValue[i] < 0.05f) {
+            tmpColor = oceanColor;
+        } else {
+            tmpColor = glm::mix(forestColor, dirtColor, glm::smoothstep(0.15f, 0.96f, noiseValue[i]));
+        }
 
-    glm::vec2 uv = glm::vec2(fragment.originalPos.x, fragment.originalPos.y);
+        if (noiseValueC[i] > 0.5f) {
+            tmpColor = cloudColor;
+        }
 
-    FastNoiseLite noiseGenerator;
-    noiseGenerator.SetNoiseType(FastNoiseLite::NoiseType_OpenSimplex2);
+        span.color[i] = Color(tmpColor.x, tmpColor.y, tmpColor.z) * span.intensity[i];
+    }
+}
 
+// MAKE A SHADER TO DISPLAY PLAIN NOISE
+void noiseFragmentShader(FragmentSpan& span, NoiseQuality quality) {
     float ox = 5500.0f;
     float oy = 6900.0f;
     float z = 150.0f;
 
-    float noiseValue = noiseGenerator.GetNoise((uv.x + ox) * z, (uv.y + oy) * z);
-
-    color = Color(noiseValue, noiseValue, noiseValue);
+    float noiseX[SPAN_SIZE];
+    float noiseY[SPAN_SIZE];
+    for (int i = 0; i < span.count; ++i) {
+        noiseX[i] = (span.ox[i] + ox) * z;
+        noiseY[i] = (span.oy[i] + oy) * z;
+    }
 
-    fragment.color = color * fragment.intensity;
+    float noiseValue[SPAN_SIZE];
+    noiseBatch(quality, simplexNoise, noiseX, noiseY, noiseValue, span.count);
 
-    return fragment;
+    for (int i = 0; i < span.count; ++i) {
+        span.color[i] = Color(noiseValue[i], noiseValue[i], noiseValue[i]) * span.intensity[i];
+    }
 }
 
-Fragment shipFragmentShader(Fragment& fragment) {
-    Color color;
-
+void shipFragmentShader(FragmentSpan& span) {
     // just paint all the ship with white for now
-    color = Color(1.0f, 1.0f, 1.0f);
+    Color color = Color(1.0f, 1.0f, 1.0f);
 
-    fragment.color = color * fragment.intensity;
-
-    return fragment;
+    for (int i = 0; i < span.count; ++i) {
+        span.color[i] = color * span.intensity[i];
+    }
 }
\ No newline at end of file
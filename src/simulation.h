@@ -0,0 +1,99 @@
+// simulation.h
+#pragma once
+#include <algorithm>
+#include <chrono>
+
+// Angulos animados del sistema solar, en grados
+struct SolarSystemState {
+    float rotationSun = 0.2f;
+    float rotationEarth = 0.0f;
+    float rotationMars = 0.0f;
+    float rotationJupiter = 0.0f;
+    float rotationUranus = 0.0f;
+
+    float orbitEarth = 0.0f;
+    float orbitMars = 0.0f;
+    float orbitJupiter = 0.0f;
+    float orbitUranus = 0.0f;
+
+    bool operator==(const SolarSystemState&) const = default;
+};
+
+// Un paso de simulacion dura 1/60 s: las velocidades son grados por paso, asi la escena se mueve
+// igual que cuando avanzaba un frame a 60 fps
+constexpr double SIMULATION_STEP = 1.0 / 60.0;
+
+inline SolarSystemState stepSimulation(SolarSystemState state, float rotationSpeed, float orbitSpeed) {
+    state.rotationSun += rotationSpeed * 0.2f;
+    state.rotationEarth += rotationSpeed * 0.8f;
+    state.rotationMars += rotationSpeed * 0.6f;
+    state.rotationJupiter += rotationSpeed * 0.4f;
+    state.rotationUranus += rotationSpeed * 0.3f;
+
+    state.orbitEarth += 1.0f * orbitSpeed;
+    state.orbitMars += 0.8f * orbitSpeed;
+    state.orbitJupiter += 0.6f * orbitSpeed;
+    state.orbitUranus += 0.4f * orbitSpeed;
+    return state;
+}
+
+// Estado entre dos pasos: t = 0 es a, t = 1 es b
+inline SolarSystemState interpolate(const SolarSystemState& a, const SolarSystemState& b, float t) {
+    auto mix = [t](float x, float y) { return x + (y - x) * t; };
+    SolarSystemState state;
+    state.rotationSun = mix(a.rotationSun, b.rotationSun);
+    state.rotationEarth = mix(a.rotationEarth, b.rotationEarth);
+    state.rotationMars = mix(a.rotationMars, b.rotationMars);
+    state.rotationJupiter = mix(a.rotationJupiter, b.rotationJupiter);
+    state.rotationUranus = mix(a.rotationUranus, b.rotationUranus);
+    state.orbitEarth = mix(a.orbitEarth, b.orbitEarth);
+    state.orbitMars = mix(a.orbitMars, b.orbitMars);
+    state.orbitJupiter = mix(a.orbitJupiter, b.orbitJupiter);
+    state.orbitUranus = mix(a.orbitUranus, b.orbitUranus);
+    return state;
+}
+
+// Reloj de la simulacion: acumula tiempo real y lo gasta en pasos fijos, independiente de cuantos
+// frames se dibujen. Lo que sobra (menos de un paso) da la fraccion para interpolar entre el
+// penultimo y el ultimo paso. En lockstep cada frame avanza exactamente un paso sin mirar el
+// reloj: la misma secuencia de estados a cualquier velocidad de render, para medir o correr sin
+// ventana mas rapido que el tiempo real.
+class SimulationClock {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    bool lockstep = false;
+
+    // Pasos que tocan desde la ultima llamada
+    int advance() {
+        if (lockstep) {
+            return 1;
+        }
+        Clock::time_point now = Clock::now();
+        accumulator += std::chrono::duration<double>(now - last).count();
+        last = now;
+
+        // Tras un frame muy largo se pierde tiempo en vez de encadenar pasos sin fin
+        accumulator = std::min(accumulator, MAX_STEPS * SIMULATION_STEP);
+        int steps = int(accumulator / SIMULATION_STEP);
+        accumulator -= steps * SIMULATION_STEP;
+        return steps;
+    }
+
+    // Descarta el tiempo transcurrido, p. ej. despues de estar esperando eventos sin dibujar
+    void skip() {
+        last = Clock::now();
+        accumulator = 0.0;
+    }
+
+    // Fraccion del paso en curso ya transcurrida; 1 en lockstep (se dibuja el ultimo paso)
+    float alpha() const {
+        return lockstep ? 1.0f : float(accumulator / SIMULATION_STEP);
+    }
+
+private:
+    static constexpr int MAX_STEPS = 8;
+
+    Clock::time_point last = Clock::now();
+    double accumulator = 0.0;
+};
@@ -0,0 +1,153 @@
+// skybox.h
+#pragma once
+#include <glm/glm.hpp>
+#include <array>
+#include <vector>
+#include <cmath>
+#include "color.h"
+#include "noise.h"
+#include "gl.h"
+
+// Texels por lado de cada cara del cubo; a 1024 un texel cubre ~0.09 grados, cerca de un pixel
+// de pantalla con el fov de 45 grados de createProjectionMatrix()
+constexpr int SKYBOX_SIZE = 1024;
+
+// Estrellas: celdas de ~8 texels, cada una con un punto que se ve si cae cerca de la esfera
+struct StarNoise : FastNoiseSettings {
+    static constexpr float frequency = 1.0f / 8.0f;
+    static constexpr FastNoiseLite::NoiseType noiseType = FastNoiseLite::NoiseType_Cellular;
+    static constexpr FastNoiseLite::CellularReturnType cellularReturnType = FastNoiseLite::CellularReturnType_Distance;
+};
+
+// Nebulosa: nubes grandes y tenues
+struct NebulaNoise : FastNoiseSettings {
+    static constexpr int seed = 4242;
+    static constexpr float frequency = 1.0f / 400.0f;
+    static constexpr FastNoiseLite::NoiseType noiseType = FastNoiseLite::NoiseType_OpenSimplex2;
+    static constexpr FastNoiseLite::FractalType fractalType = FastNoiseLite::FractalType_FBm;
+    static constexpr int fractalOctaves = 4;
+};
+
+// Ejes de cada cara: direccion = major + u * uAxis + v * vAxis, con u, v en [-1, 1]
+struct CubeFace {
+    glm::vec3 major;
+    glm::vec3 uAxis;
+    glm::vec3 vAxis;
+};
+
+const std::array<CubeFace, 6> cubeFaces = {{
+    {{ 1, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+    {{-1, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+    {{ 0, 1, 0}, {1, 0, 0}, {0, 0, 1}},
+    {{ 0,-1, 0}, {1, 0, 0}, {0, 0, 1}},
+    {{ 0, 0, 1}, {1, 0, 0}, {0, 1, 0}},
+    {{ 0, 0,-1}, {1, 0, 0}, {0, 1, 0}},
+}};
+
+struct Skybox {
+    std::array<std::vector<Color>, 6> faces;
+};
+
+Skybox skybox;
+
+// Hornea las 6 caras en el pool de jobs.h, una fila de texels por tarea
+void bakeSkybox() {
+    const FastNoiseStatic<StarNoise> starNoise;
+    const FastNoiseStatic<NebulaNoise> nebulaNoise;
+
+    // Radio de la esfera en unidades de ruido: un texel ~ una unidad en el centro de cada cara
+    const float radius = SKYBOX_SIZE / 2.0f;
+    // Distancia (en celdas) al punto de la celda por debajo de la cual se ve la estrella
+    const float starRadius = 0.12f;
+
+    const glm::vec3 nebulaA = glm::vec3(0.10f, 0.03f, 0.20f);
+    const glm::vec3 nebulaB = glm::vec3(0.02f, 0.10f, 0.22f);
+
+    for (auto& face : skybox.faces) {
+        face.resize(SKYBOX_SIZE * SKYBOX_SIZE);
+    }
+
+    parallelFor(0, 6 * SKYBOX_SIZE, 1, [&](int row) {
+        int f = row / SKYBOX_SIZE;
+        int j = row % SKYBOX_SIZE;
+        const CubeFace& face = cubeFaces[f];
+
+        float xs[SKYBOX_SIZE], ys[SKYBOX_SIZE], zs[SKYBOX_SIZE];
+        float stars[SKYBOX_SIZE], nebula[SKYBOX_SIZE], hue[SKYBOX_SIZE];
+        float v = (j + 0.5f) / SKYBOX_SIZE * 2.0f - 1.0f;
+        for (int i = 0; i < SKYBOX_SIZE; ++i) {
+            float u = (i + 0.5f) / SKYBOX_SIZE * 2.0f - 1.0f;
+            glm::vec3 dir = glm::normalize(face.major + u * face.uAxis + v * face.vAxis) * radius;
+            xs[i] = dir.x;
+            ys[i] = dir.y;
+            zs[i] = dir.z;
+        }
+
+        starNoise.GetNoiseBatch(xs, ys, zs, stars, SKYBOX_SIZE);
+        nebulaNoise.GetNoiseBatch(xs, ys, zs, nebula, SKYBOX_SIZE);
+        nebulaNoise.GetNoiseBatch(zs, xs, ys, hue, SKYBOX_SIZE);
+
+        Color* out = &skybox.faces[f][j * SKYBOX_SIZE];
+        for (int i = 0; i < SKYBOX_SIZE; ++i) {
+            float cloud = glm::smoothstep(0.0f, 0.7f, nebula[i]) * 0.6f;
+            glm::vec3 color = glm::mix(nebulaA, nebulaB, hue[i] * 0.5f + 0.5f) * cloud;
+
+            // Distance devuelve distancia^2 - 1, en celdas
+            float distance = std::sqrt(std::max(stars[i] + 1.0f, 0.0f));
+            if (distance < starRadius) {
+                float brightness = 1.0f - distance / starRadius;
+                color += glm::vec3(brightness);
+            }
+
+            color = glm::min(color, glm::vec3(1.0f));
+            out[i] = Color(color.x, color.y, color.z);
+        }
+    });
+}
+
+// Texel del cubo en la direccion dir (no necesita estar normalizada)
+inline const Color& sampleSkybox(const glm::vec3& dir) {
+    float ax = std::abs(dir.x);
+    float ay = std::abs(dir.y);
+    float az = std::abs(dir.z);
+
+    int f;
+    float u, v, major;
+    if (ax >= ay && ax >= az) {
+        f = dir.x > 0 ? 0 : 1;
+        u = dir.z; v = dir.y; major = ax;
+    } else if (ay >= az) {
+        f = dir.y > 0 ? 2 : 3;
+        u = dir.x; v = dir.z; major = ay;
+    } else {
+        f = dir.z > 0 ? 4 : 5;
+        u = dir.x; v = dir.y; major = az;
+    }
+
+    float scale = 0.5f * SKYBOX_SIZE / major;
+    int i = std::min(int(u * scale + 0.5f * SKYBOX_SIZE), SKYBOX_SIZE - 1);
+    int j = std::min(int(v * scale + 0.5f * SKYBOX_SIZE), SKYBOX_SIZE - 1);
+    return skybox.faces[f][std::max(j, 0) * SKYBOX_SIZE + std::max(i, 0)];
+}
+
+// Rellena con el cielo solo los pixeles que ningun modelo cubrio, ni con z-buffer ni en modo pintor
+void drawSkybox(const glm::mat4& view, const glm::mat4& projection) {
+    // Solo la rotacion de la camara: el cielo esta en el infinito y no depende de su posicion
+    glm::mat4 invViewProj = glm::inverse(projection * glm::mat4(glm::mat3(view)));
+
+    // Punto del plano lejano bajo cada pixel, en coordenadas homogeneas. Es lineal en x, y de
+    // pantalla y w > 0 dentro del frustum, asi que xyz ya apunta en la direccion del pixel
+    glm::vec4 origin = invViewProj * glm::vec4(1.0f / SCREEN_WIDTH - 1.0f, 1.0f / SCREEN_HEIGHT - 1.0f, 1.0f, 1.0f);
+    glm::vec4 stepX = invViewProj * glm::vec4(2.0f / SCREEN_WIDTH, 0.0f, 0.0f, 0.0f);
+    glm::vec4 stepY = invViewProj * glm::vec4(0.0f, 2.0f / SCREEN_HEIGHT, 0.0f, 0.0f);
+
+    for (int y = 0; y < SCREEN_HEIGHT; ++y) {
+        glm::vec4 row = origin + stepY * float(y);
+        for (int x = 0; x < SCREEN_WIDTH; ++x) {
+            if (zbuffer.isFar(x, y) && !painted.isCovered(x, y)) {
+                glm::vec4 h = row + stepX * float(x);
+                (*framebuffer)(x, y) = sampleSkybox(glm::vec3(h));
+            }
+        }
+    }
+}
@@ -0,0 +1,125 @@
+// sortlast.h
+#pragma once
+#include <vector>
+#include <limits>
+#include <algorithm>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "gl.h"
+
+// Sort-last: cada modelo se dibuja en su propia imagen parcial (color + profundidad float),
+// recortada a su rectangulo en pantalla, y al final las parciales se combinan por profundidad.
+// Un planeta pequeno solo necesita una imagen pequena.
+
+// Profundidad de un pixel vacio: mas lejos que cualquier fragmento, con z normal o invertida
+constexpr float SORT_LAST_FAR = DepthFormat::Reversed ? -std::numeric_limits<float>::infinity()
+                                                       : std::numeric_limits<float>::infinity();
+
+inline bool sortLastCloser(float a, float b) {
+    return DepthFormat::Reversed ? a > b : a < b;
+}
+
+struct PartialImage {
+    int x0 = 0, y0 = 0;          // esquina en pantalla
+    int width = 0, height = 0;   // 0 si el modelo no cae en pantalla
+    std::vector<float> depth;
+    std::vector<Color> color;
+
+    // Ajusta la imagen al rectangulo [x0, x1] x [y0, y1] (ya recortado a la pantalla) y la limpia
+    void reset(int left, int top, int right, int bottom) {
+        x0 = left;
+        y0 = top;
+        width = std::max(0, right - left + 1);
+        height = std::max(0, bottom - top + 1);
+        depth.assign(size_t(width) * height, SORT_LAST_FAR);
+        color.resize(size_t(width) * height);
+    }
+
+    // Prueba de profundidad privada de la imagen; solo la usa el hilo que dibuja este modelo
+    void write(const FragmentSpan& span) {
+        for (int i = 0; i < span.count; ++i) {
+            int x = span.x[i] - x0;
+            int y = span.y[i] - y0;
+            if (x < 0 || y < 0 || x >= width || y >= height) {
+                continue;
+            }
+            size_t index = size_t(y) * width + x;
+            if (sortLastCloser(span.z[i], depth[index])) {
+                depth[index] = span.z[i];
+                color[index] = span.color[i];
+            }
+        }
+    }
+};
+
+// Imagen de pantalla completa donde se combinan las parciales, en filas
+struct SortLastTarget {
+    std::vector<float> depth = std::vector<float>(size_t(SCREEN_WIDTH) * SCREEN_HEIGHT, SORT_LAST_FAR);
+    std::vector<Color> color = std::vector<Color>(size_t(SCREEN_WIDTH) * SCREEN_HEIGHT);
+};
+
+// Se reserva la primera vez que se usa el modo
+inline SortLastTarget& sortLastTarget() {
+    static SortLastTarget target;
+    return target;
+}
+
+// Limpia la profundidad del rectangulo [x0, x1) x [y0, y1) del destino
+inline void clearSortLast(int x0, int y0, int x1, int y1) {
+    SortLastTarget& target = sortLastTarget();
+    for (int y = y0; y < y1; ++y) {
+        std::fill(target.depth.begin() + size_t(y) * SCREEN_WIDTH + x0, target.depth.begin() + size_t(y) * SCREEN_WIDTH + x1, SORT_LAST_FAR);
+    }
+}
+
+// Mezcla una fila de la parcial con la del destino: de 4 en 4 pixeles compara profundidades y
+// elige color y profundidad con una mascara, sin saltos
+inline void compositeRow(const float* srcDepth, const Color* srcColor, float* dstDepth, Color* dstColor, int count) {
+    int i = 0;
+#if defined(__SSE2__)
+    for (; i + 4 <= count; i += 4) {
+        __m128 src = _mm_loadu_ps(srcDepth + i);
+        __m128 dst = _mm_loadu_ps(dstDepth + i);
+        __m128 closer = DepthFormat::Reversed ? _mm_cmpgt_ps(src, dst) : _mm_cmplt_ps(src, dst);
+        __m128i mask = _mm_castps_si128(closer);
+
+        _mm_storeu_ps(dstDepth + i, _mm_or_ps(_mm_and_ps(closer, src), _mm_andnot_ps(closer, dst)));
+
+        __m128i srcRgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcColor + i));
+        __m128i dstRgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dstColor + i));
+        __m128i merged = _mm_or_si128(_mm_and_si128(mask, srcRgba), _mm_andnot_si128(mask, dstRgba));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dstColor + i), merged);
+    }
+#endif
+    for (; i < count; ++i) {
+        if (sortLastCloser(srcDepth[i], dstDepth[i])) {
+            dstDepth[i] = srcDepth[i];
+            dstColor[i] = srcColor[i];
+        }
+    }
+}
+
+// Mezcla la fila de pantalla y de la parcial, si la cubre
+inline void compositeRow(const PartialImage& partial, int y) {
+    if (y < partial.y0 || y >= partial.y0 + partial.height || partial.width == 0) {
+        return;
+    }
+    SortLastTarget& target = sortLastTarget();
+    size_t dst = size_t(y) * SCREEN_WIDTH + partial.x0;
+    size_t src = size_t(y - partial.y0) * partial.width;
+    compositeRow(&partial.depth[src], &partial.color[src], &target.depth[dst], &target.color[dst], partial.width);
+}
+
+// Copia al framebuffer los pixeles cubiertos de las filas [y0, y1) y columnas [x0, x1)
+inline void resolveSortLast(int x0, int y0, int x1, int y1) {
+    const SortLastTarget& target = sortLastTarget();
+    for (int y = y0; y < y1; ++y) {
+        for (int x = x0; x < x1; ++x) {
+            size_t index = size_t(y) * SCREEN_WIDTH + x;
+            if (target.depth[index] != SORT_LAST_FAR) {
+                (*framebuffer)(x, y) = target.color[index];
+            }
+        }
+    }
+}
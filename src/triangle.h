@@ -1,5 +1,6 @@
 #pragma once
 #include "gl.h"
+#include <mutex>
 
 glm::vec3 L = glm::vec3(0.0f, 0.0f, 1.0f);
 
@@ -19,64 +20,204 @@ std::pair<float, float> barycentricCoordinates(const glm::ivec2& P, const glm::v
     );
 }
 
-std::vector<Fragment> triangle(const Vertex& a, const Vertex& b, const Vertex& c) {
-    std::vector<Fragment> fragments;
-    glm::vec3 A = a.position;
-    glm::vec3 B = b.position;
-    glm::vec3 C = c.position;
+// Cuantos modelos descarta la oclusion por esferas, y cuantos triangulos, tiles y pixeles el
+// z jerarquico antes de sombrear
+struct RasterStats {
+    long models = 0;
+    long modelsOccluded = 0;
+    long triangles = 0;
+    long trianglesRejected = 0;
+    long tiles = 0;
+    long tilesRejected = 0;
+    long pixels = 0;        // pixeles dentro de un triangulo
+    long pixelsRejected = 0; // descartados por early-z antes de sombrear
+};
+
+RasterStats rasterStats;
+std::mutex rasterStatsMutex;
+
+// Suma a rasterStats lo que conto una tarea del pool. models y modelsOccluded no, esos los cuenta
+// el hilo principal sin lock
+void mergeRasterStats(const RasterStats& stats) {
+    std::lock_guard<std::mutex> lock(rasterStatsMutex);
+    rasterStats.triangles += stats.triangles;
+    rasterStats.trianglesRejected += stats.trianglesRejected;
+    rasterStats.tiles += stats.tiles;
+    rasterStats.tilesRejected += stats.tilesRejected;
+    rasterStats.pixels += stats.pixels;
+    rasterStats.pixelsRejected += stats.pixelsRejected;
+}
+
+void printRasterStats(int frames) {
+    auto percent = [](long part, long total) { return total > 0 ? 100.0 * part / total : 0.0; };
+    std::cout << "Occlusion (" << frames << " frames): models " << percent(rasterStats.modelsOccluded, rasterStats.models) << "% culled" << std::endl;
+    std::cout << "HiZ (" << frames << " frames): triangles " << percent(rasterStats.trianglesRejected, rasterStats.triangles)
+              << "% rejected, tiles " << percent(rasterStats.tilesRejected, rasterStats.tiles)
+              << "%, early-z pixels " << percent(rasterStats.pixelsRejected, rasterStats.pixels) << "%" << std::endl;
+    rasterStats = RasterStats();
+}
+
+// Triangulo de espaldas a la camara: en pantalla (y hacia abajo) sus vertices quedan en sentido
+// horario. Solo vale para modelos cerrados con caras en sentido antihorario vistas desde afuera
+inline bool backFacing(const glm::vec3& A, const glm::vec3& B, const glm::vec3& C) {
+    return (B.x - A.x) * (C.y - A.y) - (B.y - A.y) * (C.x - A.x) < 0.0f;
+}
+
+// Rectangulo de pixeles con los extremos incluidos
+struct ClipRect {
+    int x0, y0, x1, y1;
 
+    bool empty() const { return x0 > x1 || y0 > y1; }
+};
+
+// Pixeles cuyo centro puede caer dentro del triangulo, recortados a la pantalla
+inline ClipRect triangleBounds(const glm::vec3& A, const glm::vec3& B, const glm::vec3& C) {
     float minX = std::min(std::min(A.x, B.x), C.x);
     float minY = std::min(std::min(A.y, B.y), C.y);
     float maxX = std::max(std::max(A.x, B.x), C.x);
     float maxY = std::max(std::max(A.y, B.y), C.y);
+    return {std::max(static_cast<int>(std::ceil(minX)), 0), std::max(static_cast<int>(std::ceil(minY)), 0),
+            std::min(static_cast<int>(std::floor(maxX)), SCREEN_WIDTH - 1),
+            std::min(static_cast<int>(std::floor(maxY)), SCREEN_HEIGHT - 1)};
+}
 
-    // Iterate over each point in the bounding box
-    for (int y = static_cast<int>(std::ceil(minY)); y <= static_cast<int>(std::floor(maxY)); ++y) {
-        for (int x = static_cast<int>(std::ceil(minX)); x <= static_cast<int>(std::floor(maxX)); ++x) {
-            if (x < 0 || y < 0 || y > SCREEN_HEIGHT || x > SCREEN_WIDTH)
-                continue;
+// Rasterizes the triangle into the spans of the model being drawn. The last span is filled
+// up before a new one is started, so spans stay full across small triangles. Only the
+// varying V requested by the material is interpolated.
+// Before any per-pixel work the nearest depth of the triangle is tested against the farthest depth
+// of every 8x8 tile it covers (first the whole triangle, then tile by tile), and each covered
+// pixel is tested against the depth buffer before it is queued for shading. With DepthTest off
+// (painter's mode) none of that happens and every covered pixel is queued.
+// Only pixels inside clip are visited, and the counters go to stats; a pool task passes its own
+// tile and its own stats, so it touches nothing another task uses.
+template <Varying V, bool DepthTest = true>
+void triangle(const Vertex& a, const Vertex& b, const Vertex& c, std::vector<FragmentSpan>& spans, const ClipRect& clip, RasterStats& stats) {
+    constexpr int TILE = decltype(zbuffer)::TILE;
 
-            glm::ivec2 P(x, y);
-            auto barycentric = barycentricCoordinates(P, A, B, C);
-            float w = 1 - barycentric.first - barycentric.second;
-            float v = barycentric.first;
-            float u = barycentric.second;
-            float epsilon = 1e-10;
+    glm::vec3 A = a.position;
+    glm::vec3 B = b.position;
+    glm::vec3 C = c.position;
 
-            if (w < epsilon || v < epsilon || u < epsilon)
-                continue;
+    // Clip the bounding box to the screen and to clip
+    ClipRect bounds = triangleBounds(A, B, C);
+    int startX = std::max(bounds.x0, clip.x0);
+    int startY = std::max(bounds.y0, clip.y0);
+    int endX = std::min(bounds.x1, clip.x1);
+    int endY = std::min(bounds.y1, clip.y1);
 
-            double z = A.z * w + B.z * v + C.z * u;
+    if (startX > endX || startY > endY) {
+        return;
+    }
 
-            glm::vec3 normal = glm::normalize(
-                    a.normal * w + b.normal * v + c.normal * u
-            );
+    // Tiles cubiertos por el bounding box y si cada uno puede tener algun pixel visible
+    using Depth = DepthFormat::Stored;
+    Depth nearestZ = DepthFormat::encode(A.z);
+    for (Depth z : {DepthFormat::encode(B.z), DepthFormat::encode(C.z)}) {
+        if (DepthFormat::closer(z, nearestZ)) {
+            nearestZ = z;
+        }
+    }
+    int tileX0 = startX / TILE, tileX1 = endX / TILE;
+    int tileY0 = startY / TILE, tileY1 = endY / TILE;
+
+    if constexpr (DepthTest) {
+        stats.triangles++;
+        bool visible = false;
+        for (int ty = tileY0; ty <= tileY1 && !visible; ++ty) {
+            for (int tx = tileX0; tx <= tileX1 && !visible; ++tx) {
+                visible = DepthFormat::closer(nearestZ, zbuffer.farthest(tx, ty));
+            }
+        }
+        if (!visible) {
+            stats.trianglesRejected++;
+            return;
+        }
+    }
 
-            // glm::vec3 normal = a.normal; // assume flatness
-            float intensity = glm::dot(normal, L);
+    if (spans.empty()) {
+        spans.emplace_back();
+    }
+    FragmentSpan* span = &spans.back();
+
+    for (int ty = tileY0; ty <= tileY1; ++ty) {
+        for (int tx = tileX0; tx <= tileX1; ++tx) {
+            if constexpr (DepthTest) {
+                stats.tiles++;
+                if (!DepthFormat::closer(nearestZ, zbuffer.farthest(tx, ty))) {
+                    stats.tilesRejected++;
+                    continue;
+                }
+            }
 
-            float manualIntensityClamp = 0.07f;
+            int tileStartX = std::max(startX, tx * TILE);
+            int tileEndX = std::min(endX, tx * TILE + TILE - 1);
+            int tileStartY = std::max(startY, ty * TILE);
+            int tileEndY = std::min(endY, ty * TILE + TILE - 1);
+
+            // Iterate over each point of the bounding box inside this tile
+            for (int y = tileStartY; y <= tileEndY; ++y) {
+                for (int x = tileStartX; x <= tileEndX; ++x) {
+                    glm::ivec2 P(x, y);
+                    auto barycentric = barycentricCoordinates(P, A, B, C);
+                    float w = 1 - barycentric.first - barycentric.second;
+                    float v = barycentric.first;
+                    float u = barycentric.second;
+                    float epsilon = 1e-10;
+
+                    if (w < epsilon || v < epsilon || u < epsilon)
+                        continue;
+
+                    double z = A.z * w + B.z * v + C.z * u;
+
+                    // Early-z: la profundidad guardada solo puede bajar, asi que si ya pierde
+                    // ahora tambien perderia en point()
+                    if constexpr (DepthTest) {
+                        stats.pixels++;
+                        if (!DepthFormat::closer(DepthFormat::encode(static_cast<float>(z)), zbuffer.get(x, y))) {
+                            stats.pixelsRejected++;
+                            continue;
+                        }
+                    }
 
-            if (intensity < manualIntensityClamp){
-                intensity = manualIntensityClamp;
+                    glm::vec3 normal = glm::normalize(
+                            a.normal * w + b.normal * v + c.normal * u
+                    );
 
-            }
+                    // glm::vec3 normal = a.normal; // assume flatness
+                    float intensity = glm::dot(normal, L);
 
-            Color color = Color(255, 255, 255);
+                    float manualIntensityClamp = 0.07f;
 
-            glm::vec3 worldPos = a.worldPos * w + b.worldPos * v + c.worldPos * u;
-            glm::vec3 originalPos = a.originalPos * w + b.originalPos * v + c.originalPos * u;
+                    if (intensity < manualIntensityClamp){
+                        intensity = manualIntensityClamp;
 
-            fragments.push_back(
-                    Fragment{
-                            glm::vec3(x, y, z),
-                            color,
-                            intensity,
-                            worldPos,
-                            originalPos
                     }
-            );
+
+                    if (span->count == SPAN_SIZE) {
+                        spans.emplace_back();
+                        span = &spans.back();
+                    }
+
+                    int i = span->count++;
+                    span->x[i] = x;
+                    span->y[i] = y;
+                    span->z[i] = static_cast<float>(z);
+                    span->intensity[i] = intensity;
+
+                    if constexpr (V != Varying::None) {
+                        glm::vec3 varying = a.varying * w + b.varying * v + c.varying * u;
+                        span->ox[i] = varying.x;
+                        span->oy[i] = varying.y;
+                        span->oz[i] = varying.z;
+                    }
+                }
+            }
         }
     }
-    return fragments;
-}
\ No newline at end of file
+}
+
+// Todo el triangulo, contando en rasterStats; solo desde un hilo a la vez
+template <Varying V, bool DepthTest = true>
+void triangle(const Vertex& a, const Vertex& b, const Vertex& c, std::vector<FragmentSpan>& spans) {
+    triangle<V, DepthTest>(a, b, c, spans, ClipRect{0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1}, rasterStats);
+}
@@ -39,17 +39,29 @@ glm::mat4 createProjectionMatrix() {
     float nearClip = 0.1f;
     float farClip = 100.0f;
 
-    return glm::perspective(glm::radians(fovInDegrees), aspectRatio, nearClip, farClip);
+    glm::mat4 projection = glm::perspective(glm::radians(fovInDegrees), aspectRatio, nearClip, farClip);
+
+    // Z invertida: z_ndc va de 1 en nearClip a 0 en farClip, sin pasar por [-1, 1]
+    if constexpr (DepthFormat::Reversed) {
+        projection[2][2] = nearClip / (farClip - nearClip);
+        projection[3][2] = nearClip * farClip / (farClip - nearClip);
+    }
+
+    return projection;
 }
 
 glm::mat4 createViewportMatrix() {
     glm::mat4 viewport = glm::mat4(1.0f);
 
+    // Con z invertida la proyeccion ya deja z en [0, 1]; si no, z_ndc en [-1, 1] pasa a [0, 1]
+    float depthScale = DepthFormat::Reversed ? 1.0f : 0.5f;
+    float depthOffset = DepthFormat::Reversed ? 0.0f : 1.0f;
+
     // Scale
-    viewport = glm::scale(viewport, glm::vec3(SCREEN_WIDTH / 2.0f, SCREEN_HEIGHT / 2.0f, 0.5f));
+    viewport = glm::scale(viewport, glm::vec3(SCREEN_WIDTH / 2.0f, SCREEN_HEIGHT / 2.0f, depthScale));
 
     // Translate
-    viewport = glm::translate(viewport, glm::vec3(1.0f, 1.0f, 0.5f));
+    viewport = glm::translate(viewport, glm::vec3(1.0f, 1.0f, depthOffset));
 
     return viewport;
 }